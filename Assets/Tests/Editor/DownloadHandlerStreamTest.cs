@@ -0,0 +1,50 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System.IO;
+    using System.Linq;
+    using System.Threading.Tasks;
+    using NUnit.Framework;
+    using UnityEngine.Networking;
+    using Types;
+    using DownloadHandlerStream = Internal.DownloadHandlerStream;
+
+    internal sealed class DownloadHandlerStreamTest {
+
+        private MockServer server;
+        private Function fxn;
+
+        [SetUp]
+        public void Before () {
+            server = new MockServer();
+            fxn = new Function(url: server.url);
+        }
+
+        [TearDown]
+        public void After () => server.Dispose();
+
+        [Test(Description = @"Should deliver response data in order across received chunks")]
+        public async Task ReadInOrder () {
+            // Use reads that do not line up with received chunks
+            var data = Enumerable.Range(0, 4 << 20).Select(idx => (byte)(idx * 31 + (idx >> 16))).ToArray();
+            var url = await fxn.Storage.Upload(@"data.bin", new MemoryStream(data), UploadType.Value);
+            var downloadHandler = new DownloadHandlerStream();
+            var request = new UnityWebRequest(url, UnityWebRequest.kHttpVerbGET, downloadHandler, null) {
+                disposeDownloadHandlerOnDispose = true,
+            };
+            request.SendWebRequest();
+            using var stream = downloadHandler.CreateStream(request);
+            using var result = new MemoryStream();
+            var buffer = new byte[1000];
+            int bytesRead;
+            while ((bytesRead = await stream.ReadAsync(buffer, 0, buffer.Length)) > 0)
+                result.Write(buffer, 0, bytesRead);
+            Assert.That(result.Length, Is.EqualTo(data.Length));
+            Assert.That(result.ToArray(), Is.EqualTo(data));
+        }
+    }
+}
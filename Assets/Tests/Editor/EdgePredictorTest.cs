@@ -0,0 +1,92 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.Collections.Generic;
+    using System.Linq;
+    using System.Threading;
+    using System.Threading.Tasks;
+    using NUnit.Framework;
+    using Services;
+    using Types;
+    using PredictorReference = Internal.PredictorReference;
+    using ValueArena = Internal.ValueArena;
+
+    internal sealed class EdgePredictorTest {
+
+        private MockServer server;
+        private Function fxn;
+
+        [SetUp]
+        public void Before () {
+            server = new MockServer();
+            fxn = new Function(url: server.url);
+        }
+
+        [TearDown]
+        public void After () => server.Dispose();
+
+        [Test(Description = @"Should create a single predictor when concurrent calls load the same predictor")]
+        public async Task LoadOnce () {
+            var loads = 0;
+            fxn.Predictions.loader = async (prediction, acceleration, device) => {
+                Interlocked.Increment(ref loads);
+                await Task.Delay(100);
+                return new PredictorReference(IntPtr.Zero, release: _ => { });
+            };
+            var sessions = await Task.WhenAll(Enumerable.Range(0, 16).Select(_ => Task.Run(() => fxn.Predictions.CreateSession(@"@mock/edge"))));
+            foreach (var session in sessions)
+                session.Dispose();
+            Assert.That(loads, Is.EqualTo(1));
+        }
+
+        [Test(Description = @"Should keep a reloaded predictor alive until its last reference is released")]
+        public async Task ReloadWhileInUse () {
+            var references = new List<PredictorReference>();
+            var released = new List<int>();
+            fxn.Predictions.loader = (prediction, acceleration, device) => {
+                var reference = new PredictorReference(new IntPtr(references.Count + 1), release: predictor => released.Add((int)predictor));
+                references.Add(reference);
+                return Task.FromResult(reference);
+            };
+            (await fxn.Predictions.CreateSession(@"@mock/edge")).Dispose();
+            // Hold a reference like an in-flight prediction
+            var current = references[0];
+            Assert.That(current.TryAcquire(), Is.True);
+            // Reload
+            await fxn.Predictions.Reload(@"@mock/edge");
+            Assert.That(references.Count, Is.EqualTo(2));
+            Assert.That(released, Is.Empty);
+            current.Release();
+            Assert.That(released, Is.EqualTo(new [] { 1 }));
+            Assert.That(current.TryAcquire(), Is.False);
+            // Delete
+            Assert.That(await fxn.Predictions.Delete(@"@mock/edge"), Is.True);
+            Assert.That(released, Is.EqualTo(new [] { 1, 2 }));
+        }
+
+        [Test(Description = @"Should lend session inputs to predictions and release them when the session is disposed")]
+        public async Task DisposeSession () {
+            fxn.Predictions.loader = (prediction, acceleration, device) => Task.FromResult(new PredictorReference(IntPtr.Zero, release: _ => { }));
+            var session = await fxn.Predictions.CreateSession(@"@mock/edge", new () { ["scale"] = 2.5f });
+            var binding = session.bindings[@"scale"];
+            // Lend the session inputs to an input map, like a prediction
+            var inputs = new Dictionary<string, object> { [@"name"] = @"fxn" };
+            using (var arena = new ValueArena()) {
+                var inputMap = PredictionService.CreateInputs(inputs, session, arena);
+                PredictionService.ReleaseInputs(inputMap, inputs, session);
+            }
+            // Releasing the input map must not release the lent inputs
+            Assert.That(Internal.Function.GetValueType(binding, out var type), Is.EqualTo(Internal.Function.Status.Ok));
+            Assert.That(type, Is.EqualTo(Dtype.Float32));
+            // Dispose
+            session.Dispose();
+            Assert.That(session.inputs, Is.Empty);
+            Assert.Throws<ObjectDisposedException>(() => _ = session.bindings);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.IO;
+    using System.Linq;
+    using NUnit.Framework;
+    using Types;
+    using Metric = Types.EmbeddingIndex.Metric;
+
+    internal sealed class EmbeddingIndexTest {
+
+        [Test(Description = @"Should find the same neighbors as a brute-force search")]
+        public void SearchExact ([Values(Metric.DotProduct, Metric.Cosine, Metric.Euclidean)] Metric metric) {
+            const int Dimensions = 37;
+            var embeddings = CreateEmbeddings(1000, Dimensions, 1);
+            var query = CreateEmbeddings(1, Dimensions, 2);
+            var index = new EmbeddingIndex(Dimensions, metric);
+            index.Add(new Tensor<float>(embeddings, new [] { 1000, Dimensions }));
+            var neighbors = index.Search(query, 5);
+            var expected = Enumerable.Range(0, 1000)
+                .Select(row => (row, score: Score(query, embeddings.AsSpan(row * Dimensions, Dimensions).ToArray(), metric)))
+                .OrderBy(pair => metric == Metric.Euclidean ? pair.score : -pair.score)
+                .Take(5)
+                .Select(pair => pair.row)
+                .ToArray();
+            Assert.That(neighbors.Select(neighbor => neighbor.index), Is.EqualTo(expected));
+        }
+
+        [Test(Description = @"Should search a batch of queries")]
+        public void SearchBatch () {
+            var embeddings = CreateEmbeddings(100, 16, 3);
+            var index = new EmbeddingIndex(16, Metric.Euclidean);
+            index.Add(embeddings);
+            var results = index.Search(new Tensor<float>(embeddings, new [] { 100, 16 }).Slice(10, 3), 1);
+            Assert.That(results.Select(neighbors => neighbors[0].index), Is.EqualTo(new [] { 10, 11, 12 }));
+        }
+
+        [Test(Description = @"Should roundtrip an index through a file")]
+        public void SaveAndLoad () {
+            var path = Path.Combine(Path.GetTempPath(), $"fxn-{Guid.NewGuid():N}.index");
+            try {
+                var index = new EmbeddingIndex(8, Metric.Cosine);
+                index.Add(CreateEmbeddings(50, 8, 4));
+                index.Save(path);
+                var loaded = EmbeddingIndex.Load(path);
+                var query = CreateEmbeddings(1, 8, 5);
+                Assert.That(loaded.count, Is.EqualTo(50));
+                Assert.That(loaded.metric, Is.EqualTo(Metric.Cosine));
+                Assert.That(loaded.Search(query, 3).Select(n => n.index), Is.EqualTo(index.Search(query, 3).Select(n => n.index)));
+            } finally {
+                File.Delete(path);
+            }
+        }
+
+        [Test(Description = @"Should find the same neighbors as a brute-force search when searching partitions in parallel")]
+        public void SearchPartitioned () {
+            const int Count = 20_000, Dimensions = 16;
+            var embeddings = CreateEmbeddings(Count, Dimensions, 6);
+            var query = CreateEmbeddings(1, Dimensions, 7);
+            var index = new EmbeddingIndex(Dimensions);
+            index.Add(embeddings);
+            var neighbors = index.Search(query, 10);
+            var expected = Enumerable.Range(0, Count)
+                .Select(row => (row, score: Score(query, embeddings.AsSpan(row * Dimensions, Dimensions).ToArray(), Metric.DotProduct)))
+                .OrderByDescending(pair => pair.score)
+                .Take(10)
+                .Select(pair => pair.row)
+                .ToArray();
+            Assert.That(neighbors.Select(neighbor => neighbor.index), Is.EqualTo(expected));
+        }
+
+        [Test(Description = @"Should return no neighbors when no results are requested")]
+        public void SearchNoResults ([Values(0, -1)] int count) {
+            var index = new EmbeddingIndex(4);
+            index.Add(CreateEmbeddings(10, 4, 8));
+            Assert.That(index.Search(CreateEmbeddings(1, 4, 9), count), Is.Empty);
+            Assert.That(index.Search(new Tensor<float>(CreateEmbeddings(2, 4, 9), new [] { 2, 4 }), count), Has.All.Empty);
+        }
+
+        private static float[] CreateEmbeddings (int count, int dimensions, int seed) {
+            var random = new Random(seed);
+            var embeddings = new float[count * dimensions];
+            for (var idx = 0; idx < embeddings.Length; ++idx)
+                embeddings[idx] = (float)random.NextDouble() * 2f - 1f;
+            return embeddings;
+        }
+
+        private static double Score (float[] a, float[] b, Metric metric) {
+            if (metric == Metric.Euclidean)
+                return a.Zip(b, (x, y) => (double)(x - y) * (x - y)).Sum();
+            var dot = a.Zip(b, (x, y) => (double)x * y).Sum();
+            return metric == Metric.Cosine ? dot / Math.Sqrt(b.Sum(x => (double)x * x)) : dot;
+        }
+    }
+}
@@ -0,0 +1,132 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.IO;
+    using System.Linq;
+    using System.Net.Http;
+    using System.Threading;
+    using System.Threading.Tasks;
+    using NUnit.Framework;
+    using Types;
+    using Debug = UnityEngine.Debug;
+
+    internal sealed class LoadTest {
+
+        private MockServer server;
+        private Function fxn;
+
+        [SetUp]
+        public void Before () {
+            server = new MockServer(seed: 1);
+            fxn = new Function(url: server.url);
+        }
+
+        [TearDown]
+        public void After () => server.Dispose();
+
+        [Test(Description = @"Should create cloud predictions at high concurrency")]
+        public async Task CreateCloudPredictions () {
+            server.latency = TimeSpan.FromMilliseconds(5);
+            var report = await Run(1024, 64, async idx => {
+                var prediction = await fxn.Predictions.Create(@"@mock/identity", new () {
+                    ["index"] = idx,
+                    ["name"] = $"request {idx}",
+                });
+                Assert.That(prediction.results?[0], Is.EqualTo(idx));
+                Assert.That(prediction.results?[1], Is.EqualTo($"request {idx}"));
+            });
+            Debug.Log($"Cloud predictions: {report}");
+            Assert.That(report.errors, Is.Zero);
+        }
+
+        [Test(Description = @"Should upload and download values through signed URLs at high concurrency")]
+        public async Task UploadAndDownload () {
+            var data = Enumerable.Range(0, 64 * 1024).Select(i => (byte)i).ToArray();
+            var report = await Run(256, 32, async idx => {
+                var url = await fxn.Storage.Upload($"data_{idx}.bin", new MemoryStream(data), UploadType.Value);
+                Assert.That(url, Does.StartWith(server.url));
+                var stream = await fxn.Storage.Download(url);
+                Assert.That(stream.ToArray(), Is.EqualTo(data));
+            });
+            Debug.Log($"Storage roundtrips: {report}");
+            Assert.That(report.errors, Is.Zero);
+        }
+
+        [Test(Description = @"Should stream cloud predictions at high concurrency")]
+        public async Task StreamCloudPredictions () {
+            var report = await Run(256, 32, async idx => {
+                var count = 0;
+                await foreach (var prediction in fxn.Predictions.Stream(@"@mock/identity", new () { ["index"] = idx })) {
+                    Assert.That(prediction.results?[0], Is.EqualTo(idx));
+                    ++count;
+                }
+                Assert.That(count, Is.EqualTo(1));
+            });
+            Debug.Log($"Streaming predictions: {report}");
+            Assert.That(report.errors, Is.Zero);
+        }
+
+        [Test(Description = @"Should surface injected API errors")]
+        public async Task SurfaceInjectedErrors () {
+            server.errorRate = 0.25;
+            var report = await Run(512, 64, async idx => {
+                await fxn.Predictions.Create(@"@mock/identity", new () { ["index"] = idx });
+            });
+            Debug.Log($"Cloud predictions with injected errors: {report}");
+            Assert.That(report.errors, Is.InRange(64, 192));
+            Assert.That(report.errors + report.latencies.Length, Is.EqualTo(512));
+        }
+
+        private static async Task<LoadReport> Run (int count, int concurrency, Func<int, Task> request) {
+            var latencies = new List<double>(count);
+            var errors = 0;
+            var next = -1;
+            var stopwatch = Stopwatch.StartNew();
+            var workers = Enumerable.Range(0, concurrency).Select(_ => Task.Run(async () => {
+                for (var idx = Interlocked.Increment(ref next); idx < count; idx = Interlocked.Increment(ref next)) {
+                    var start = stopwatch.Elapsed;
+                    try {
+                        await request(idx);
+                        lock (latencies)
+                            latencies.Add((stopwatch.Elapsed - start).TotalMilliseconds);
+                    } catch (Exception ex) when (ex is InvalidOperationException || ex is HttpRequestException || ex is OperationCanceledException || ex is IOException) {
+                        // Count API and transport failures, but let assertion failures fail the test
+                        Interlocked.Increment(ref errors);
+                    }
+                }
+            }));
+            await Task.WhenAll(workers);
+            return new LoadReport(latencies.OrderBy(latency => latency).ToArray(), errors, stopwatch.Elapsed);
+        }
+
+        private sealed class LoadReport {
+
+            public readonly double[] latencies;
+            public readonly int errors;
+            public readonly TimeSpan duration;
+
+            public LoadReport (double[] latencies, int errors, TimeSpan duration) {
+                this.latencies = latencies;
+                this.errors = errors;
+                this.duration = duration;
+            }
+
+            public double Percentile (double p) => latencies.Length > 0 ?
+                latencies[Math.Min(latencies.Length - 1, (int)(p * latencies.Length))] :
+                double.NaN;
+
+            public override string ToString () =>
+                $"{latencies.Length + errors} requests in {duration.TotalSeconds:0.00}s " +
+                $"({(latencies.Length + errors) / duration.TotalSeconds:0.0} req/s), " +
+                $"p50={Percentile(0.50):0.0}ms p95={Percentile(0.95):0.0}ms p99={Percentile(0.99):0.0}ms, " +
+                $"{errors} errors";
+        }
+    }
+}
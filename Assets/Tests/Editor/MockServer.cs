@@ -0,0 +1,176 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.Collections.Concurrent;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using System.Net;
+    using System.Net.Sockets;
+    using System.Text;
+    using System.Threading.Tasks;
+    using Newtonsoft.Json;
+    using Newtonsoft.Json.Linq;
+    using API;
+    using Types;
+
+    /// <summary>
+    /// Local stub of the Function API for offline and load testing.
+    /// Predictions echo their inputs back as results, like `@natml/identity`.
+    /// Predictors with `@mock/edge` tags are reported as edge predictors without resources.
+    /// </summary>
+    internal sealed class MockServer : IDisposable {
+
+        #region --Client API--
+        /// <summary>
+        /// Server URL.
+        /// </summary>
+        public readonly string url;
+
+        /// <summary>
+        /// Latency added to every response.
+        /// </summary>
+        public TimeSpan latency;
+
+        /// <summary>
+        /// Fraction of requests that fail with an injected error.
+        /// Errors are injected from a seeded generator so that runs are deterministic.
+        /// </summary>
+        public double errorRate;
+
+        /// <summary>
+        /// Number of requests served.
+        /// </summary>
+        public int requests => requestCount;
+
+        public MockServer (int seed = 0) {
+            var port = GetFreePort();
+            url = $"http://localhost:{port}/";
+            random = new Random(seed);
+            storage = new ConcurrentDictionary<string, byte[]>();
+            listener = new HttpListener();
+            listener.Prefixes.Add(url);
+            listener.Start();
+            Task.Run(Listen);
+        }
+
+        public void Dispose () => listener.Close();
+        #endregion
+
+
+        #region --Operations--
+        private readonly HttpListener listener;
+        private readonly Random random;
+        private readonly ConcurrentDictionary<string, byte[]> storage;
+        private int requestCount;
+
+        private async Task Listen () {
+            while (listener.IsListening) {
+                HttpListenerContext context;
+                try {
+                    context = await listener.GetContextAsync();
+                } catch (Exception) when (!listener.IsListening) {
+                    break;
+                }
+                _ = Task.Run(() => Serve(context));
+            }
+        }
+
+        private async Task Serve (HttpListenerContext context) {
+            using var response = context.Response;
+            var request = context.Request;
+            // Some `HttpListener` implementations drop reused connections after reading a request body
+            response.KeepAlive = false;
+            var path = request.Url.AbsolutePath.Trim('/');
+            System.Threading.Interlocked.Increment(ref requestCount);
+            // Inject latency and errors
+            if (latency > TimeSpan.Zero)
+                await Task.Delay(latency);
+            bool fail;
+            lock (random)
+                fail = random.NextDouble() < errorRate;
+            if (fail) {
+                await Respond(response, 500, new ErrorResponse { errors = new [] { new ErrorResponse.Error { message = @"Injected error" } } });
+                return;
+            }
+            // Route
+            if (request.HttpMethod == @"POST" && path.StartsWith(@"predict/"))
+                await Respond(response, 200, await Predict(path.Substring(@"predict/".Length), request));
+            else if (request.HttpMethod == @"POST" && path == @"graph")
+                await Respond(response, 200, await Query(request));
+            else if (request.HttpMethod == @"PUT" && path.StartsWith(@"storage/")) {
+                using var stream = new MemoryStream();
+                await request.InputStream.CopyToAsync(stream);
+                storage[path] = stream.ToArray();
+                await Respond(response, 200, new { });
+            }
+            else if (request.HttpMethod == @"GET" && storage.TryGetValue(path, out var data)) {
+                response.StatusCode = 200;
+                response.ContentLength64 = data.Length;
+                await response.OutputStream.WriteAsync(data, 0, data.Length);
+            }
+            else
+                await Respond(response, 404, new ErrorResponse { errors = new [] { new ErrorResponse.Error { message = $"Cannot {request.HttpMethod} /{path}" } } });
+        }
+
+        private async Task<Prediction> Predict (string tag, HttpListenerRequest request) {
+            var payload = await ReadPayload<Dictionary<string, Value>>(request);
+            // Edge predictors are loaded by the client, which only needs their resources
+            if (tag.StartsWith(@"@mock/edge"))
+                return new Prediction {
+                    id = Guid.NewGuid().ToString(),
+                    tag = tag,
+                    type = PredictorType.Edge,
+                    created = DateTime.UtcNow,
+                    resources = new PredictionResource[0],
+                    configuration = string.Empty,
+                };
+            return new Prediction {
+                id = Guid.NewGuid().ToString(),
+                tag = tag,
+                type = PredictorType.Cloud,
+                created = DateTime.UtcNow,
+                results = payload?.Values.Cast<object>().ToArray() ?? new object[0],
+                latency = latency.TotalMilliseconds,
+            };
+        }
+
+        private async Task<object> Query (HttpListenerRequest request) {
+            var payload = await ReadPayload<GraphRequest>(request);
+            if (payload?.query.Contains(@"createUploadUrl") ?? false) {
+                var input = (payload.variables![@"input"] as JObject)!;
+                var name = input[@"name"]!.ToString();
+                return new { data = new { createUploadUrl = $"{url}storage/{Guid.NewGuid():N}/{name}" } };
+            }
+            return new { data = (object)null };
+        }
+
+        private static async Task<T> ReadPayload<T> (HttpListenerRequest request) {
+            using var reader = new StreamReader(request.InputStream, Encoding.UTF8);
+            return JsonConvert.DeserializeObject<T>(await reader.ReadToEndAsync());
+        }
+
+        private static async Task Respond (HttpListenerResponse response, int status, object payload) {
+            var settings = new JsonSerializerSettings { NullValueHandling = NullValueHandling.Ignore };
+            var data = Encoding.UTF8.GetBytes(JsonConvert.SerializeObject(payload, settings));
+            response.StatusCode = status;
+            response.ContentType = @"application/json";
+            response.ContentLength64 = data.Length;
+            await response.OutputStream.WriteAsync(data, 0, data.Length);
+        }
+
+        internal static int GetFreePort () {
+            var socket = new TcpListener(IPAddress.Loopback, 0);
+            socket.Start();
+            var port = ((IPEndPoint)socket.LocalEndpoint).Port;
+            socket.Stop();
+            return port;
+        }
+        #endregion
+    }
+}
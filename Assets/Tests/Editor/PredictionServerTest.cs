@@ -0,0 +1,64 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System.Net.Http;
+    using System.Text;
+    using System.Threading.Tasks;
+    using NUnit.Framework;
+    using API;
+    using Types;
+
+    internal sealed class PredictionServerTest {
+
+        private MockServer backend;
+        private PredictionServer server;
+        private Function fxn;
+
+        [SetUp]
+        public void Before () {
+            backend = new MockServer();
+            server = new PredictionServer(new Function(url: backend.url), $"http://localhost:{MockServer.GetFreePort()}/");
+            server.Start();
+            fxn = new Function(new DotNetClient(server.url));
+        }
+
+        [TearDown]
+        public void After () {
+            server.Dispose();
+            backend.Dispose();
+        }
+
+        [Test(Description = @"Should create predictions through the prediction server with a `DotNetClient`")]
+        public async Task CreatePrediction () {
+            var prediction = await fxn.Predictions.Create(@"@mock/identity", new () {
+                ["radius"] = 4.5f,
+                ["name"] = "fxn",
+            });
+            Assert.That(prediction.type, Is.EqualTo(PredictorType.Cloud));
+            Assert.That(prediction.resources, Is.Null);
+            Assert.That(prediction.results?[0], Is.EqualTo(4.5f));
+            Assert.That(prediction.results?[1], Is.EqualTo("fxn"));
+        }
+
+        [Test(Description = @"Should respond with a client error to malformed prediction requests")]
+        public async Task RejectMalformedRequest () {
+            using var client = new HttpClient();
+            using var content = new StringContent(@"{ ""radius"": ", Encoding.UTF8, @"application/json");
+            using var response = await client.PostAsync($"{server.url}predict/@mock/identity", content);
+            Assert.That((int)response.StatusCode, Is.EqualTo(400));
+        }
+
+        [Test(Description = @"Should respond with a server error when the prediction fails")]
+        public async Task ReportPredictionFailure () {
+            backend.errorRate = 1;
+            using var client = new HttpClient();
+            using var content = new StringContent(@"{}", Encoding.UTF8, @"application/json");
+            using var response = await client.PostAsync($"{server.url}predict/@mock/identity", content);
+            Assert.That((int)response.StatusCode, Is.EqualTo(500));
+        }
+    }
+}
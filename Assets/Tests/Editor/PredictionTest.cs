@@ -5,9 +5,17 @@
 
 namespace Function.Tests {
 
+    using System;
     using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using System.Runtime.InteropServices;
     using System.Threading.Tasks;
+    using Newtonsoft.Json;
+    using Newtonsoft.Json.Linq;
+    using Newtonsoft.Json.Serialization;
     using NUnit.Framework;
+    using Services;
     using Types;
 
     internal sealed class PredictionTest {
@@ -47,5 +55,110 @@ namespace Function.Tests {
             Assert.AreEqual(inputs["ratio"], ratio);
             Assert.AreEqual(inputs["option"], option);
         }
+
+        [Test(Description = @"Should widen half-precision values to single precision")]
+        public async Task ConvertHalfValue () {
+            var value = new Value {
+                data = @"data:application/octet-stream;base64,ADwAwAA4AQAA/A==",
+                type = Dtype.Float16,
+                shape = new [] { 5 }
+            };
+            var tensor = (Tensor<float>)await fxn.Predictions.ToObject(value);
+            Assert.That(tensor.shape, Is.EqualTo(new [] { 5 }));
+            Assert.That(tensor.data, Is.EqualTo(new [] { 1f, -2f, 0.5f, 5.9604645e-8f, float.NegativeInfinity }));
+        }
+
+        [Test(Description = @"Should reject edge predictions that are missing a required input")]
+        public void RejectMissingInput () {
+            var signature = new Signature {
+                inputs = new [] {
+                    new Parameter { name = "image", type = Dtype.Image },
+                    new Parameter { name = "threshold", type = Dtype.Float32, optional = true },
+                    new Parameter { name = "scale", type = Dtype.Float32, defaultValue = new Value { type = Dtype.Float32 } },
+                },
+                outputs = new Parameter[0],
+            };
+            PredictionService.CheckInputs("@fxn/test", signature, new [] { "image" });
+            var error = Assert.Throws<ArgumentException>(() => PredictionService.CheckInputs("@fxn/test", signature, new [] { "threshold", "scale" }));
+            Assert.That(error.Message, Does.Contain("image"));
+        }
+
+        [Test(Description = @"Should create binary values from streams backed by a safe buffer")]
+        public unsafe void CreateSafeBufferValue () {
+            var data = new byte[] { 1, 2, 3, 4, 5, 6, 7, 8 };
+            using var buffer = new NativeBuffer(data.Length);
+            using var stream = new UnmanagedMemoryStream(buffer, 0, data.Length, FileAccess.ReadWrite);
+            stream.Write(data, 0, data.Length);
+            stream.Position = 3;
+            using var arena = new Internal.ValueArena();
+            var value = PredictionService.ToValue(stream, arena);
+            try {
+                Assert.That(Internal.Function.GetValueData(value, out var result), Is.EqualTo(Internal.Function.Status.Ok));
+                Assert.That(new ReadOnlySpan<byte>((void*)result, data.Length - 3).ToArray(), Is.EqualTo(data.Skip(3).ToArray()));
+            } finally {
+                Internal.Function.ReleaseValue(value);
+            }
+        }
+
+        [Test(Description = @"Should deserialize prediction results like the default serializer")]
+        public void DeserializePredictionResults () {
+            var json = @"{
+                ""id"": ""pred_0"",
+                ""tag"": ""@fxn/test"",
+                ""type"": ""CLOUD"",
+                ""created"": ""2024-01-01T00:00:00Z"",
+                ""results"": [
+                    12,
+                    3.5,
+                    ""fxn"",
+                    true,
+                    null,
+                    [1, 2, 3],
+                    { ""data"": ""data:,"", ""type"": ""float32"", ""shape"": [1] }
+                ],
+                ""latency"": 12.5
+            }";
+            var prediction = JsonConvert.DeserializeObject<Prediction>(json)!;
+            var reference = JsonConvert.DeserializeObject<Prediction>(json, new JsonSerializerSettings {
+                ContractResolver = new ReflectionContractResolver()
+            })!;
+            Assert.AreEqual(reference.created, prediction.created);
+            Assert.AreEqual(reference.latency, prediction.latency);
+            Assert.AreEqual(reference.results!.Length, prediction.results!.Length);
+            for (var i = 0; i < 5; ++i) {
+                Assert.AreEqual(reference.results[i]?.GetType(), prediction.results[i]?.GetType());
+                Assert.AreEqual(reference.results[i], prediction.results[i]);
+            }
+            Assert.IsTrue(JToken.DeepEquals(reference.results[5] as JToken, prediction.results[5] as JToken));
+            var expected = (reference.results[6] as JObject)!.ToObject<Value>()!;
+            var value = (Value)prediction.results[6]!;
+            Assert.AreEqual(expected.data, value.data);
+            Assert.AreEqual(expected.type, value.type);
+            Assert.AreEqual(expected.shape, value.shape);
+            Assert.AreEqual(3.5f, (float)(double)prediction.results[1]!);
+        }
+
+        private sealed class NativeBuffer : SafeBuffer {
+
+            public NativeBuffer (int size) : base(true) {
+                SetHandle(Marshal.AllocHGlobal(size));
+                Initialize((ulong)size);
+            }
+
+            protected override bool ReleaseHandle () {
+                Marshal.FreeHGlobal(handle);
+                return true;
+            }
+        }
+
+        private sealed class ReflectionContractResolver : DefaultContractResolver {
+
+            protected override JsonContract CreateContract (Type objectType) {
+                var contract = base.CreateContract(objectType);
+                if (objectType == typeof(Prediction))
+                    contract.Converter = null;
+                return contract;
+            }
+        }
     }
 }
\ No newline at end of file
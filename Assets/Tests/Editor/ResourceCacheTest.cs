@@ -0,0 +1,88 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.IO;
+    using System.Linq;
+    using System.Security.Cryptography;
+    using System.Threading.Tasks;
+    using NUnit.Framework;
+    using Services;
+    using Types;
+
+    internal sealed class ResourceCacheTest {
+
+        private string directory;
+
+        [SetUp]
+        public void Before () {
+            directory = Path.Combine(Path.GetTempPath(), $"fxn-{Guid.NewGuid():N}");
+            Directory.CreateDirectory(directory);
+        }
+
+        [TearDown]
+        public void After () => Directory.Delete(directory, true);
+
+        [Test(Description = @"Should evict cached resources whose contents do not match their hash record")]
+        public async Task EvictCorruptResource () {
+            var data = CreateData(1 << 20);
+            var path = Path.Combine(directory, @"resource.bin");
+            await PredictionService.WriteCache(path, stream => stream.WriteAsync(data, 0, data.Length));
+            // Copy the resource to paths which have not been validated yet, corrupting one copy without changing its size
+            var validPath = Path.Combine(directory, @"valid.bin");
+            var corruptPath = Path.Combine(directory, @"corrupt.bin");
+            File.Copy(path, validPath);
+            File.Copy(path + @".xxh64", validPath + @".xxh64");
+            data[data.Length / 2] ^= 0xFF;
+            File.WriteAllBytes(corruptPath, data);
+            File.Copy(path + @".xxh64", corruptPath + @".xxh64");
+            // Validate
+            Assert.That(await PredictionService.Validate(validPath), Is.True);
+            Assert.That(await PredictionService.Validate(corruptPath), Is.False);
+            Assert.That(File.Exists(validPath), Is.True);
+            Assert.That(File.Exists(corruptPath), Is.False);
+            Assert.That(File.Exists(corruptPath + @".xxh64"), Is.False);
+        }
+
+        [Test(Description = @"Should only download the changed chunk when assembling a new resource version")]
+        public async Task AssembleChangedChunk ([Values(false, true)] bool compress) {
+            using var server = new MockServer();
+            var fxn = new Function(url: server.url, cachePath: directory);
+            fxn.Predictions.compressCache = compress;
+            var data = Enumerable.Range(0, 4).Select(idx => CreateData((3 << 20) + idx)).ToArray();
+            var chunks = await Task.WhenAll(data.Select(async chunk => new ResourceChunk {
+                hash = ToHex(SHA256.Create().ComputeHash(chunk)),
+                size = chunk.Length,
+                url = await fxn.Storage.Upload(@"chunk.bin", new MemoryStream(chunk), UploadType.Value),
+            }));
+            var v1 = new PredictionResource { type = @"bin", name = @"model-v1.bin", url = string.Empty, chunks = chunks.Take(3).ToArray() };
+            var v2 = new PredictionResource { type = @"bin", name = @"model-v2.bin", url = string.Empty, chunks = new [] { chunks[0], chunks[3], chunks[2] } };
+            // Assemble the first version from downloaded chunks
+            var requests = server.requests;
+            var (path, _) = await fxn.Predictions.Retrieve(v1);
+            Assert.That(server.requests - requests, Is.EqualTo(3));
+            Assert.That(File.ReadAllBytes(path), Is.EqualTo(data[0].Concat(data[1]).Concat(data[2]).ToArray()));
+            // Assemble the second version, reusing unchanged chunks from the first version
+            requests = server.requests;
+            (path, _) = await fxn.Predictions.Retrieve(v2);
+            Assert.That(server.requests - requests, Is.EqualTo(1));
+            Assert.That(File.ReadAllBytes(path), Is.EqualTo(data[0].Concat(data[3]).Concat(data[2]).ToArray()));
+            // Retrieve the first version again from the cache
+            requests = server.requests;
+            (path, _) = await fxn.Predictions.Retrieve(v1);
+            Assert.That(server.requests - requests, Is.Zero);
+        }
+
+        private static byte[] CreateData (int size) {
+            var data = new byte[size];
+            new Random(size).NextBytes(data);
+            return data;
+        }
+
+        private static string ToHex (byte[] data) => BitConverter.ToString(data).Replace(@"-", string.Empty).ToLowerInvariant();
+    }
+}
@@ -0,0 +1,119 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System;
+    using System.Diagnostics;
+    using System.IO;
+    using System.Linq;
+    using System.Threading.Tasks;
+    using NUnit.Framework;
+    using Internal;
+    using Debug = UnityEngine.Debug;
+
+    internal sealed class ResourceCompressionTest {
+
+        private string directory;
+
+        [SetUp]
+        public void Before () {
+            directory = Path.Combine(Path.GetTempPath(), $"fxn-{Guid.NewGuid():N}");
+            Directory.CreateDirectory(directory);
+        }
+
+        [TearDown]
+        public void After () => Directory.Delete(directory, true);
+
+        [Test(Description = @"Should roundtrip resources through the compressed format")]
+        public async Task RoundtripResource ([Values(0, 1, ResourceCompression.BlockSize, ResourceCompression.BlockSize + 17)] int size) {
+            var data = CreateWeights(size);
+            var path = Path.Combine(directory, $"resource{ResourceCompression.Extension}");
+            using (var stream = File.Create(path))
+            using (var writer = ResourceCompression.CreateWriter(stream))
+                writer.Write(data, 0, data.Length);
+            using var result = new MemoryStream();
+            await ResourceCompression.Decompress(path, result);
+            Assert.That(result.ToArray(), Is.EqualTo(data));
+        }
+
+        [Test(Description = @"Should read compressed resources from an offset into the uncompressed data")]
+        public void ReadFromOffset ([Values(0, 17, ResourceCompression.BlockSize, ResourceCompression.BlockSize + 17)] int offset) {
+            var data = CreateWeights(ResourceCompression.BlockSize + 17);
+            var path = CreateCompressedResource();
+            using var stream = ResourceCompression.OpenRead(path, offset);
+            using var result = new MemoryStream();
+            stream.CopyTo(result);
+            Assert.That(result.ToArray(), Is.EqualTo(data.Skip(offset).ToArray()));
+        }
+
+        [Test(Description = @"Should reject truncated compressed resources")]
+        public void RejectTruncatedResource ([Values(1, 8, 100)] int count) {
+            var path = CreateCompressedResource();
+            var compressed = File.ReadAllBytes(path);
+            File.WriteAllBytes(path, compressed.Take(compressed.Length - count).ToArray());
+            Assert.ThrowsAsync<InvalidDataException>(async () => await ResourceCompression.Decompress(path, Stream.Null));
+        }
+
+        [Test(Description = @"Should reject compressed resources with a corrupt index")]
+        public void RejectCorruptIndex ([Values(5, 17, 25)] int offsetFromEnd) {
+            // Corrupt the block count, the last block size, or the last block offset
+            var path = CreateCompressedResource();
+            var compressed = File.ReadAllBytes(path);
+            compressed[compressed.Length - offsetFromEnd] = 0x7F;
+            File.WriteAllBytes(path, compressed);
+            Assert.ThrowsAsync<InvalidDataException>(async () => await ResourceCompression.Decompress(path, Stream.Null));
+        }
+
+        [Test(Description = @"Should compare load latency and disk footprint against raw resources")]
+        public async Task CompareWithRawResource () {
+            var data = CreateWeights(64 << 20);
+            var rawPath = Path.Combine(directory, @"resource.bin");
+            var compressedPath = rawPath + ResourceCompression.Extension;
+            File.WriteAllBytes(rawPath, data);
+            using (var stream = File.Create(compressedPath))
+            using (var writer = ResourceCompression.CreateWriter(stream))
+                writer.Write(data, 0, data.Length);
+            // Raw load
+            var stopwatch = Stopwatch.StartNew();
+            using (var destination = File.Create(Path.Combine(directory, @"raw.bin")))
+            using (var source = File.OpenRead(rawPath))
+                await source.CopyToAsync(destination);
+            var rawLatency = stopwatch.Elapsed;
+            // Compressed load
+            stopwatch.Restart();
+            using (var destination = File.Create(Path.Combine(directory, @"expanded.bin")))
+                await ResourceCompression.Decompress(compressedPath, destination);
+            var compressedLatency = stopwatch.Elapsed;
+            // Report
+            var rawSize = new FileInfo(rawPath).Length;
+            var compressedSize = new FileInfo(compressedPath).Length;
+            Debug.Log(
+                $"Raw: {rawSize / 1e6:0.0}MB loaded in {rawLatency.TotalMilliseconds:0}ms, " +
+                $"compressed: {compressedSize / 1e6:0.0}MB loaded in {compressedLatency.TotalMilliseconds:0}ms " +
+                $"({100.0 * compressedSize / rawSize:0.0}% of raw size)"
+            );
+            Assert.That(compressedSize, Is.LessThan(rawSize));
+        }
+
+        private string CreateCompressedResource () {
+            var data = CreateWeights(ResourceCompression.BlockSize + 17);
+            var path = Path.Combine(directory, $"resource{ResourceCompression.Extension}");
+            using (var stream = File.Create(path))
+            using (var writer = ResourceCompression.CreateWriter(stream))
+                writer.Write(data, 0, data.Length);
+            return path;
+        }
+
+        private static byte[] CreateWeights (int size) {
+            // Low-precision weights, like quantized or pruned model resources
+            var random = new Random(size);
+            var data = new byte[size];
+            for (var idx = 0; idx < data.Length; ++idx)
+                data[idx] = idx % 4 == 3 ? (byte)random.Next(0x3C, 0x40) : (byte)(random.Next(4) << 6);
+            return data;
+        }
+    }
+}
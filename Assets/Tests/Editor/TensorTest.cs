@@ -0,0 +1,54 @@
+/* 
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using NUnit.Framework;
+    using Types;
+
+    internal sealed class TensorTest {
+
+        [Test(Description = @"Should pad a tensor with zeros up to a given shape")]
+        public void PadToShape () {
+            var tensor = new Tensor<int>(new [] { 1, 2, 3, 4, 5, 6 }, new [] { 2, 3 });
+            var padded = tensor.Pad(new [] { 3, 4 });
+            Assert.That(padded.shape, Is.EqualTo(new [] { 3, 4 }));
+            Assert.That(padded.data, Is.EqualTo(new [] { 1, 2, 3, 0, 4, 5, 6, 0, 0, 0, 0, 0 }));
+        }
+
+        [Test(Description = @"Should pad a tensor axis up to the nearest bucket")]
+        public void PadToBucket () {
+            var tensor = new Tensor<float>(new [] { 1f, 2f, 3f, 4f, 5f, 6f }, new [] { 2, 3 });
+            var padded = tensor.Pad(-1, 2, 4, 8);
+            Assert.That(padded.shape, Is.EqualTo(new [] { 2, 4 }));
+            Assert.That(padded.data, Is.EqualTo(new [] { 1f, 2f, 3f, 0f, 4f, 5f, 6f, 0f }));
+            var unpadded = tensor.Pad(0, 1);
+            Assert.That(unpadded.shape, Is.EqualTo(tensor.shape));
+        }
+
+        [Test(Description = @"Should slice a tensor along the first axis without copying")]
+        public unsafe void SliceFirstAxis () {
+            var tensor = new Tensor<int>(new [] { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 }, new [] { 3, 2, 2 });
+            var element = tensor.Slice(1);
+            Assert.That(element.shape, Is.EqualTo(new [] { 2, 2 }));
+            Assert.That(element.data, Is.SameAs(tensor.data));
+            fixed (int* data = element)
+                Assert.That(*data, Is.EqualTo(5));
+            var range = tensor.Slice(1, 2);
+            Assert.That(range.shape, Is.EqualTo(new [] { 2, 2, 2 }));
+            Assert.That(range.offset, Is.EqualTo(4));
+            Assert.Throws<System.ArgumentOutOfRangeException>(() => tensor.Slice(2, 2));
+        }
+
+        [Test(Description = @"Should pin an empty slice at the end of a tensor")]
+        public unsafe void SliceEmptyAtEnd () {
+            var tensor = new Tensor<int>(new [] { 1, 2, 3, 4, 5, 6 }, new [] { 3, 2 });
+            var empty = tensor.Slice(3, 0);
+            Assert.That(empty.shape, Is.EqualTo(new [] { 0, 2 }));
+            fixed (int* data = empty)
+                Assert.That((System.IntPtr)data, Is.EqualTo(System.IntPtr.Zero));
+        }
+    }
+}
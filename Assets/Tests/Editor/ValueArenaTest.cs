@@ -0,0 +1,90 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System.Diagnostics;
+    using NUnit.Framework;
+    using Internal;
+    using Services;
+    using Debug = UnityEngine.Debug;
+
+    internal sealed unsafe class ValueArenaTest {
+
+        [Test(Description = @"Should align arena allocations to 64 bytes without overlapping them")]
+        public void AlignAllocations ([Values(1, 63, 64, 1000, ValueArena.HugePageSize)] int size) {
+            using var arena = new ValueArena();
+            var previous = (byte*)null;
+            for (var idx = 0; idx < 8; ++idx) {
+                var pointer = (byte*)arena.Allocate(size);
+                Assert.That((long)pointer % ValueArena.Alignment, Is.Zero);
+                if (previous != null && pointer > previous)
+                    Assert.That(pointer - previous, Is.GreaterThanOrEqualTo(size));
+                previous = pointer;
+            }
+        }
+
+        [Test(Description = @"Should reuse arena memory after the arena is reset")]
+        public void ReuseAfterReset () {
+            using var arena = new ValueArena();
+            var first = arena.Allocate(1000);
+            arena.Allocate(1000);
+            var capacity = arena.Capacity;
+            arena.Reset();
+            Assert.That((long)arena.Allocate(1000), Is.EqualTo((long)first));
+            Assert.That(arena.Capacity, Is.EqualTo(capacity));
+        }
+
+        [Test(Description = @"Should coalesce arena chunks into a single chunk when a grown arena is reset")]
+        public void CoalesceAfterGrowth () {
+            using var arena = new ValueArena();
+            const int size = 48 << 10;
+            for (var idx = 0; idx < 4; ++idx)
+                arena.Allocate(size);
+            var capacity = arena.Capacity;
+            Assert.That(capacity, Is.GreaterThanOrEqualTo(4 * size));
+            // After coalescing, the same allocations are contiguous in one chunk
+            arena.Reset();
+            var first = (byte*)arena.Allocate(size);
+            for (var idx = 1; idx < 4; ++idx)
+                Assert.That((long)((byte*)arena.Allocate(size) - first), Is.EqualTo((long)idx * size));
+            Assert.That(arena.Capacity, Is.EqualTo(capacity));
+        }
+
+        [Test(Description = @"Should compare marshaling latency of arena values against copied values")]
+        public void CompareWithCopiedValues () {
+            var data = new float[1 << 20];
+            const int iterations = 200;
+            using var arena = new ValueArena();
+            // Warm up
+            var value = PredictionService.ToValue(data, arena);
+            value.ReleaseValue();
+            arena.Reset();
+            var capacity = arena.Capacity;
+            // Arena
+            var stopwatch = Stopwatch.StartNew();
+            for (var idx = 0; idx < iterations; ++idx) {
+                value = PredictionService.ToValue(data, arena);
+                value.ReleaseValue();
+                arena.Reset();
+            }
+            var arenaLatency = stopwatch.Elapsed;
+            // Copied
+            stopwatch.Restart();
+            for (var idx = 0; idx < iterations; ++idx) {
+                value = PredictionService.ToValue(data);
+                value.ReleaseValue();
+            }
+            var copiedLatency = stopwatch.Elapsed;
+            // Report
+            Debug.Log(
+                $"Marshaled {data.Length * sizeof(float) / 1e6:0.0}MB arrays: " +
+                $"arena: {arenaLatency.TotalMilliseconds / iterations:0.000}ms, " +
+                $"copied: {copiedLatency.TotalMilliseconds / iterations:0.000}ms per value"
+            );
+            Assert.That(arena.Capacity, Is.EqualTo(capacity));
+        }
+    }
+}
@@ -0,0 +1,39 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+namespace Function.Tests {
+
+    using System.Linq;
+    using System.Text;
+    using NUnit.Framework;
+    using Internal;
+
+    internal sealed class XXHash64Test {
+
+        [Test(Description = @"Should match XXH64 reference hashes")]
+        public void HashReferenceVectors (
+            [Values(@"", @"abc", @"Nobody inspects the spammish repetition")] string input
+        ) {
+            var expected = input switch {
+                @""     => 0xEF46DB3751D8E999UL,
+                @"abc"  => 0x44BC2CF5AD770999UL,
+                _       => 0xFBCEA83C8A378BF1UL,
+            };
+            var data = Encoding.UTF8.GetBytes(input);
+            var hash = new XXHash64();
+            hash.Append(data, 0, data.Length);
+            Assert.That(hash.GetHashAndReset(), Is.EqualTo(expected));
+        }
+
+        [Test(Description = @"Should hash data appended in pieces like data appended at once")]
+        public void HashIncrementally () {
+            var data = Enumerable.Range(0, 100).Select(i => (byte)i).ToArray();
+            var hash = new XXHash64();
+            for (var offset = 0; offset < data.Length; offset += 7)
+                hash.Append(data, offset, System.Math.Min(7, data.Length - offset));
+            Assert.That(hash.GetHashAndReset(), Is.EqualTo(0x6AC1E58032166597UL));
+        }
+    }
+}
@@ -5,14 +5,20 @@
 
 namespace Function.Editor.Build {
 
+    using System.IO;
+    using UnityEngine;
     using UnityEditor;
     using UnityEditor.Build.Reporting;
 
     internal sealed class LinuxBuildHandler : BuildHandler {
 
         protected override BuildTarget target => BuildTarget.StandaloneLinux64;
+        private const string RuntimePath = @"Packages/ai.fxn.fxn3d/Plugins/Linux/x86_64/libFunction.so";
 
         protected override Internal.FunctionSettings CreateSettings (BuildReport report) {
+            // Check runtime
+            if (!File.Exists(Path.GetFullPath(RuntimePath)))
+                Debug.LogWarning($"Function: Linux runtime was not found at {RuntimePath}. Run `python3 fxnc.py` to download it, otherwise edge predictions will fail at runtime.");
             // Create settings
             var settings = FunctionProjectSettings.CreateSettings();
             // Return
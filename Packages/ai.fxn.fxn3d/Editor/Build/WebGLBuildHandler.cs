@@ -22,6 +22,11 @@ namespace Function.Editor.Build {
             @"-lembind",
             @"-sEXTRA_EXPORTED_RUNTIME_METHODS=FS",
         };
+        private static string[] EM_THREAD_ARGS => new [] {
+            @"-pthread",
+            @"-sPTHREAD_POOL_SIZE=navigator.hardwareConcurrency",
+            @"-sPTHREAD_POOL_SIZE_STRICT=0",
+        };
 
         protected override Internal.FunctionSettings CreateSettings (BuildReport report) {
             // Patch config
@@ -50,6 +55,9 @@ namespace Function.Editor.Build {
             args.AddRange(cleanedArgs);
             args.Add(@"-Wl,-uFXN_WEBGL_PUSH");
             args.AddRange(EM_ARGS);
+            // Prewarm workers so that the runtime can start inference threads without yielding to the browser
+            if (PlayerSettings.WebGL.threadsSupport)
+                args.AddRange(EM_THREAD_ARGS);
             args.Add(@"-Wl,-uFXN_WEBGL_POP");
             return string.Join(@" ", args);
         }
@@ -69,16 +69,17 @@ namespace Function.API {
                 message.Content = new StringContent(payloadStr, Encoding.UTF8, @"application/json");
             }
             // Request
-            using var response = await client.SendAsync(message);
-            var responseStr = await response.Content.ReadAsStringAsync();
+            using var response = await client.SendAsync(message, HttpCompletionOption.ResponseHeadersRead);
+            using var stream = await response.Content.ReadAsStreamAsync();
+            using var reader = new JsonTextReader(new StreamReader(stream, Encoding.UTF8));
             // Check error
             if ((int)response.StatusCode >= 400) {
-                var errorPayload = JsonConvert.DeserializeObject<ErrorResponse>(responseStr);
+                var errorPayload = serializer.Deserialize<ErrorResponse>(reader);
                 var error = errorPayload?.errors?[0]?.message ?? @"An unknown error occurred";
                 throw new InvalidOperationException(error);
             }
             // Return
-            return JsonConvert.DeserializeObject<T>(responseStr)!;
+            return serializer.Deserialize<T>(reader)!;
         }
 
         /// <summary>
@@ -168,6 +169,7 @@ namespace Function.API {
 
         #region --Operations--
         private readonly HttpClient client;
+        private static readonly JsonSerializer serializer = JsonSerializer.CreateDefault();
         #endregion
     }
 }
\ No newline at end of file
@@ -0,0 +1,147 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.API {
+
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using System.Net;
+    using System.Text;
+    using System.Threading.Tasks;
+    using Newtonsoft.Json;
+    using Types;
+
+    /// <summary>
+    /// Local prediction server.
+    /// The server exposes the `/predict/{tag}` endpoint of the Function API so that other processes can make edge predictions
+    /// through a `DotNetClient` pointed at the server, while sharing a single set of loaded predictors.
+    /// </summary>
+    public sealed class PredictionServer : IDisposable {
+
+        #region --Client API--
+        /// <summary>
+        /// Server URL.
+        /// </summary>
+        public readonly string url;
+
+        /// <summary>
+        /// Create a local prediction server.
+        /// </summary>
+        /// <param name="fxn">Function client used to load predictors and make predictions.</param>
+        /// <param name="url">Server URL. This MUST end with a `/`.</param>
+        public PredictionServer (Function fxn, string url = @"http://localhost:8000/") {
+            this.fxn = fxn;
+            this.url = url;
+            this.listener = new HttpListener();
+            listener.Prefixes.Add(url);
+        }
+
+        /// <summary>
+        /// Start serving predictions.
+        /// </summary>
+        public void Start () {
+            listener.Start();
+            Task.Run(Listen);
+        }
+
+        /// <summary>
+        /// Stop serving predictions.
+        /// </summary>
+        public void Dispose () => listener.Close();
+        #endregion
+
+
+        #region --Operations--
+        private readonly Function fxn;
+        private readonly HttpListener listener;
+        private static readonly JsonSerializerSettings SerializerSettings = new () { NullValueHandling = NullValueHandling.Ignore };
+
+        private async Task Listen () {
+            while (listener.IsListening) {
+                HttpListenerContext context;
+                try {
+                    context = await listener.GetContextAsync();
+                } catch (Exception) when (!listener.IsListening) {
+                    break;
+                }
+                _ = Task.Run(() => Serve(context));
+            }
+        }
+
+        private async Task Serve (HttpListenerContext context) {
+            using var response = context.Response;
+            try {
+                // Check
+                var request = context.Request;
+                var requestUrl = request.Url;
+                if (requestUrl == null)
+                    throw new ServerException(400, @"Cannot serve request because its URL is invalid");
+                var segments = requestUrl.AbsolutePath.Trim('/').Split('/');
+                if (request.HttpMethod != @"POST" || segments.Length < 2 || segments[0] != @"predict")
+                    throw new ServerException(404, $"Cannot {request.HttpMethod} {requestUrl.AbsolutePath}");
+                var tag = string.Join(@"/", segments.Skip(1));
+                // Parse inputs
+                using var reader = new StreamReader(request.InputStream, request.ContentEncoding ?? Encoding.UTF8);
+                var payload = JsonConvert.DeserializeObject<Dictionary<string, Value>>(await reader.ReadToEndAsync()) ?? new();
+                var inputs = new Dictionary<string, object?>();
+                foreach (var pair in payload)
+                    inputs.Add(pair.Key, await fxn.Predictions.ToObject(pair.Value));
+                // Predict
+                var prediction = await fxn.Predictions.Create(tag, inputs, async: true);
+                // Respond with raw output values, as clients parse them locally.
+                // The prediction is reported as a cloud prediction so that clients do not try to load the predictor themselves.
+                var results = prediction.results != null ?
+                    await Task.WhenAll(prediction.results.Select(async (result, idx) =>
+                        await fxn.Predictions.ToValue(result, $"result_{idx}", minUploadSize: int.MaxValue) as object
+                    )) :
+                    null;
+                await Respond(response, 200, new Prediction {
+                    id = prediction.id,
+                    tag = prediction.tag,
+                    type = PredictorType.Cloud,
+                    created = prediction.created,
+                    results = results,
+                    resultNames = prediction.resultNames,
+                    latency = prediction.latency,
+                    error = prediction.error,
+                    logs = prediction.logs,
+                });
+            } catch (ServerException ex) {
+                await Respond(response, ex.status, ErrorFor(ex.Message));
+            } catch (Exception ex) when (ex is JsonException || ex is ArgumentException || ex is FormatException) {
+                // Malformed payloads and missing or invalid inputs
+                await Respond(response, 400, ErrorFor(ex.Message));
+            } catch (Exception ex) {
+                await Respond(response, 500, ErrorFor(ex.Message));
+            }
+        }
+
+        private static async Task Respond (HttpListenerResponse response, int status, object payload) {
+            var data = Encoding.UTF8.GetBytes(JsonConvert.SerializeObject(payload, SerializerSettings));
+            response.StatusCode = status;
+            response.ContentType = @"application/json";
+            response.ContentLength64 = data.Length;
+            await response.OutputStream.WriteAsync(data, 0, data.Length);
+        }
+
+        private static ErrorResponse ErrorFor (string message) => new ErrorResponse {
+            errors = new [] { new ErrorResponse.Error { message = message } }
+        };
+        #endregion
+
+
+        #region --Types--
+
+        private sealed class ServerException : Exception {
+            public readonly int status;
+            public ServerException (int status, string message) : base(message) => this.status = status;
+        }
+        #endregion
+    }
+}
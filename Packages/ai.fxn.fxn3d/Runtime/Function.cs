@@ -86,7 +86,7 @@ namespace Function {
             this.Users = new UserService(client);
             this.Predictors = new PredictorService(client);
             this.EnvironmentVariables = new EnvironmentVariableService(client);
-            this.Predictions = new PredictionService(client, Storage, cachePath);
+            this.Predictions = new PredictionService(client, Storage, Predictors, cachePath);
         }
         #endregion
 
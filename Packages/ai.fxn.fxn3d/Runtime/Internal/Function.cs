@@ -86,6 +86,11 @@ namespace Function.Internal {
             [MarshalAs(UnmanagedType.LPUTF8Str)] string data,
             out IntPtr value
         );
+        [DllImport(Assembly, EntryPoint = @"FXNValueCreateString")]
+        public static extern Status CreateStringValue (
+            byte* data,
+            out IntPtr value
+        );
         [DllImport(Assembly, EntryPoint = @"FXNValueCreateList")]
         public static extern Status CreateListValue (
             [MarshalAs(UnmanagedType.LPUTF8Str)] string data,
@@ -112,6 +117,13 @@ namespace Function.Internal {
             ValueFlags flags,
             out IntPtr value
         );
+        [DllImport(Assembly, EntryPoint = @"FXNValueCreateBinary")]
+        public static extern Status CreateBinaryValue (
+            byte* buffer,
+            int bufferLen,
+            ValueFlags flags,
+            out IntPtr value
+        );
         [DllImport(Assembly, EntryPoint = @"FXNValueCreateNull")]
         public static extern Status CreateNullValue (out IntPtr value);
         [DllImport(Assembly, EntryPoint = @"FXNValueCreateBySerializingValue")]
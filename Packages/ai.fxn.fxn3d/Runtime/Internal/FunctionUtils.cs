@@ -9,10 +9,12 @@ namespace Function.Internal {
 
     using System;
     using System.IO;
+    using System.Linq;
     using System.Runtime.CompilerServices;
     using System.Runtime.InteropServices;
     using System.Text;
     using System.Threading.Tasks;
+    using Types;
     using Status = Function.Status;
 
     /// <summary>
@@ -91,6 +93,24 @@ namespace Function.Internal {
             return new MemoryStream(array);
         }
 
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static unsafe Stream ToStream<T> (this Tensor<T> tensor) where T : unmanaged {
+            var count = tensor.shape.Aggregate(1, (a, b) => a * b);
+            if (tensor.data is byte[] raw)
+                return new MemoryStream(raw, tensor.offset, count, false);
+            var size = count * sizeof(T);
+            var array = new byte[size];
+            if (size > 0)
+                fixed (void* src = tensor, dst = array)
+                    Buffer.MemoryCopy(src, dst, size, size);
+            return new MemoryStream(array);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static Stream ToStream (this ReadOnlyMemory<byte> data) => MemoryMarshal.TryGetArray(data, out var segment) ?
+            new MemoryStream(segment.Array, segment.Offset, segment.Count, false) :
+            new MemoryStream(data.ToArray());
+
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         public static byte[] ToArray (this Stream stream) {
             if (stream is MemoryStream memoryStream)
@@ -103,11 +123,32 @@ namespace Function.Internal {
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         public static unsafe T[] ToArray<T> (this MemoryStream stream) where T : unmanaged {
-            var rawData = stream.ToArray();
-            var data = new T[rawData.Length / sizeof(T)];
-            Buffer.BlockCopy(rawData, 0, data, 0, rawData.Length);
+            if (!stream.TryGetBuffer(out var rawData))
+                rawData = new ArraySegment<byte>(stream.ToArray());
+            var data = new T[rawData.Count / sizeof(T)];
+            Buffer.BlockCopy(rawData.Array, rawData.Offset, data, 0, data.Length * sizeof(T));
             return data;
         }
+
+        public static void ToSingle (this ReadOnlySpan<ushort> source, Span<float> destination) {
+            for (var idx = 0; idx < source.Length; ++idx)
+                destination[idx] = ToSingle(source[idx]);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static float ToSingle (ushort value) {
+            var sign = (value & 0x8000) << 16;
+            var exponent = (value >> 10) & 0x1F;
+            var mantissa = value & 0x3FF;
+            // Subnormal
+            if (exponent == 0)
+                return (sign != 0 ? -1f : 1f) * mantissa * (1f / (1 << 24));
+            // Infinity and NaN
+            if (exponent == 0x1F)
+                return BitConverter.Int32BitsToSingle(sign | 0x7F800000 | (mantissa << 13));
+            // Normal
+            return BitConverter.Int32BitsToSingle(sign | ((exponent + 112) << 23) | (mantissa << 13));
+        }
         #endregion
 
 
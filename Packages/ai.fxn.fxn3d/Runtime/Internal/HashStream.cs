@@ -0,0 +1,64 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Internal {
+
+    using System;
+    using System.IO;
+    using System.Threading;
+    using System.Threading.Tasks;
+
+    /// <summary>
+    /// Write-through stream which hashes data as it is written to an underlying stream.
+    /// This lets downloads be verified while they are transferred, instead of in a separate pass.
+    /// </summary>
+    internal sealed class HashStream : Stream {
+
+        #region --Client API--
+        /// <summary>
+        /// Create a hash stream.
+        /// </summary>
+        /// <param name="stream">Underlying stream. This is not disposed with the hash stream.</param>
+        /// <param name="append">Delegate which appends written data to a hash.</param>
+        public HashStream (Stream stream, Action<byte[], int, int> append) {
+            this.stream = stream;
+            this.append = append;
+        }
+
+        public override bool CanRead => false;
+        public override bool CanSeek => false;
+        public override bool CanWrite => true;
+        public override long Length => length;
+        public override long Position { get => length; set => throw new NotSupportedException(); }
+
+        public override void Write (byte[] buffer, int offset, int count) {
+            append(buffer, offset, count);
+            stream.Write(buffer, offset, count);
+            length += count;
+        }
+
+        public override Task WriteAsync (byte[] buffer, int offset, int count, CancellationToken cancellationToken) {
+            append(buffer, offset, count);
+            length += count;
+            return stream.WriteAsync(buffer, offset, count, cancellationToken);
+        }
+
+        public override void Flush () => stream.Flush();
+        public override Task FlushAsync (CancellationToken cancellationToken) => stream.FlushAsync(cancellationToken);
+        public override int Read (byte[] buffer, int offset, int count) => throw new NotSupportedException();
+        public override long Seek (long offset, SeekOrigin origin) => throw new NotSupportedException();
+        public override void SetLength (long value) => throw new NotSupportedException();
+        #endregion
+
+
+        #region --Operations--
+        private readonly Stream stream;
+        private readonly Action<byte[], int, int> append;
+        private long length;
+        #endregion
+    }
+}
@@ -0,0 +1,143 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Internal {
+
+    using System;
+    using System.Collections.Generic;
+    using System.Reflection;
+    using System.Runtime.Serialization;
+    using Newtonsoft.Json;
+    using Newtonsoft.Json.Linq;
+    using Types;
+
+    /// <summary>
+    /// Non-reflective JSON reader for prediction values.
+    /// Values are written with the default serializer.
+    /// </summary>
+    [Preserve]
+    internal sealed class ValueConverter : JsonConverter<Value> {
+
+        public override bool CanWrite => false;
+
+        public override Value? ReadJson (
+            JsonReader reader,
+            Type objectType,
+            Value? existingValue,
+            bool hasExistingValue,
+            JsonSerializer serializer
+        ) {
+            if (reader.TokenType == JsonToken.Null)
+                return null;
+            var value = new Value();
+            while (reader.Read() && reader.TokenType == JsonToken.PropertyName) {
+                switch ((string)reader.Value!) {
+                    case @"data":   value.data = reader.ReadAsString(); break;
+                    case @"type":   value.type = EnumMap<Dtype>.Parse(reader.ReadAsString()); break;
+                    case @"shape":  value.shape = ReadShape(reader); break;
+                    default:        reader.Read(); reader.Skip(); break;
+                }
+            }
+            return value;
+        }
+
+        public override void WriteJson (JsonWriter writer, Value? value, JsonSerializer serializer) => throw new NotSupportedException();
+
+        private static int[]? ReadShape (JsonReader reader) {
+            reader.Read();
+            if (reader.TokenType == JsonToken.Null)
+                return null;
+            var shape = new List<int>(4);
+            while (reader.ReadAsInt32() is int dim)
+                shape.Add(dim);
+            return shape.ToArray();
+        }
+    }
+
+    /// <summary>
+    /// Non-reflective JSON reader for predictions.
+    /// Prediction results that are objects are read directly as prediction values.
+    /// Other results are read exactly as the default serializer reads them.
+    /// Predictions are written with the default serializer.
+    /// </summary>
+    [Preserve]
+    internal sealed class PredictionConverter : JsonConverter<Prediction> {
+
+        public override bool CanWrite => false;
+
+        public override Prediction? ReadJson (
+            JsonReader reader,
+            Type objectType,
+            Prediction? existingValue,
+            bool hasExistingValue,
+            JsonSerializer serializer
+        ) {
+            if (reader.TokenType == JsonToken.Null)
+                return null;
+            var prediction = new Prediction();
+            while (reader.Read() && reader.TokenType == JsonToken.PropertyName) {
+                switch ((string)reader.Value!) {
+                    case @"id":             prediction.id = reader.ReadAsString()!; break;
+                    case @"tag":            prediction.tag = reader.ReadAsString()!; break;
+                    case @"type":           prediction.type = EnumMap<PredictorType>.Parse(reader.ReadAsString()); break;
+                    case @"created":        prediction.created = reader.ReadAsDateTime() ?? default; break;
+                    case @"results":        prediction.results = ReadResults(reader, serializer); break;
+                    case @"resultNames":    reader.Read(); prediction.resultNames = serializer.Deserialize<string[]?>(reader); break;
+                    case @"latency":        prediction.latency = reader.ReadAsDouble(); break;
+                    case @"error":          prediction.error = reader.ReadAsString(); break;
+                    case @"logs":           prediction.logs = reader.ReadAsString(); break;
+                    case @"resources":      reader.Read(); prediction.resources = serializer.Deserialize<PredictionResource[]?>(reader); break;
+                    case @"configuration":  prediction.configuration = reader.ReadAsString(); break;
+                    default:                reader.Read(); reader.Skip(); break;
+                }
+            }
+            return prediction;
+        }
+
+        public override void WriteJson (JsonWriter writer, Prediction? value, JsonSerializer serializer) => throw new NotSupportedException();
+
+        private static object?[]? ReadResults (JsonReader reader, JsonSerializer serializer) {
+            reader.Read();
+            if (reader.TokenType == JsonToken.Null)
+                return null;
+            var results = new List<object?>();
+            while (reader.Read() && reader.TokenType != JsonToken.EndArray)
+                results.Add(reader.TokenType switch {
+                    JsonToken.Null          => null,
+                    JsonToken.StartObject   => serializer.Deserialize<Value>(reader),
+                    JsonToken.StartArray    => JToken.ReadFrom(reader),
+                    _                       => reader.Value, // same primitive as the default serializer
+                });
+            return results.ToArray();
+        }
+    }
+
+    /// <summary>
+    /// Cached mapping from serialized enumeration member names to values.
+    /// </summary>
+    internal static class EnumMap<T> where T : struct, Enum {
+
+        public static T Parse (string? name) => name != null && Members.TryGetValue(name, out var value) ?
+            value :
+            throw new JsonSerializationException($"Cannot deserialize `{typeof(T).Name}` because '{name}' is not a valid member");
+
+        private static readonly Dictionary<string, T> Members = CreateMembers();
+
+        private static Dictionary<string, T> CreateMembers () {
+            var result = new Dictionary<string, T>(StringComparer.OrdinalIgnoreCase);
+            foreach (var field in typeof(T).GetFields(BindingFlags.Public | BindingFlags.Static)) {
+                var value = (T)field.GetValue(null);
+                var member = field.GetCustomAttribute<EnumMemberAttribute>()?.Value;
+                if (member != null)
+                    result[member] = value;
+                if (!result.ContainsKey(field.Name))
+                    result[field.Name] = value;
+            }
+            return result;
+        }
+    }
+}
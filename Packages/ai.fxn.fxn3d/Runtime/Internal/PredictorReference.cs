@@ -0,0 +1,93 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Internal {
+
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Threading;
+    using Types;
+
+    /// <summary>
+    /// Reference-counted edge predictor.
+    /// The predictor cache holds one reference and every in-flight prediction holds another,
+    /// so a predictor that is replaced or deleted is only released once its in-flight predictions complete.
+    /// </summary>
+    internal sealed class PredictorReference {
+
+        #region --Client API--
+        /// <summary>
+        /// Native predictor.
+        /// </summary>
+        public readonly IntPtr predictor;
+
+        /// <summary>
+        /// Predictor signature.
+        /// This is `null` if the signature could not be retrieved when the predictor was loaded.
+        /// </summary>
+        public readonly Signature? signature;
+
+        /// <summary>
+        /// Create a predictor reference.
+        /// The reference starts with a single count, which is owned by the creator.
+        /// </summary>
+        /// <param name="predictor">Native predictor.</param>
+        /// <param name="signature">Predictor signature.</param>
+        /// <param name="transientPaths">Resource files which are deleted when the predictor is released.</param>
+        /// <param name="release">Function which releases the native predictor. This defaults to `FXNPredictorRelease`.</param>
+        public PredictorReference (
+            IntPtr predictor,
+            Signature? signature = null,
+            IReadOnlyList<string>? transientPaths = null,
+            Action<IntPtr>? release = null
+        ) {
+            this.predictor = predictor;
+            this.signature = signature;
+            this.transientPaths = transientPaths;
+            this.release = release ?? (predictor => predictor.ReleasePredictor().Throw());
+            this.count = 1;
+        }
+
+        /// <summary>
+        /// Try to acquire a reference to the predictor.
+        /// This fails if the predictor has already been released.
+        /// </summary>
+        /// <returns>Whether a reference was acquired.</returns>
+        public bool TryAcquire () {
+            while (true) {
+                var current = Volatile.Read(ref count);
+                if (current == 0)
+                    return false;
+                if (Interlocked.CompareExchange(ref count, current + 1, current) == current)
+                    return true;
+            }
+        }
+
+        /// <summary>
+        /// Release a reference to the predictor.
+        /// The native predictor is released when the last reference is released.
+        /// </summary>
+        public void Release () {
+            if (Interlocked.Decrement(ref count) != 0)
+                return;
+            release(predictor);
+            foreach (var path in transientPaths ?? Array.Empty<string>())
+                try {
+                    File.Delete(path);
+                } catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException) { }
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly IReadOnlyList<string>? transientPaths;
+        private readonly Action<IntPtr> release;
+        private int count;
+        #endregion
+    }
+}
@@ -0,0 +1,250 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Internal {
+
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.IO.Compression;
+    using System.Linq;
+    using System.Threading.Tasks;
+
+    /// <summary>
+    /// Block-compressed resource format for the predictor resource cache.
+    /// Resources are split into fixed-size blocks which are deflated independently and indexed in a footer,
+    /// so that any block can be located without decompressing the blocks before it,
+    /// and so that blocks can be decompressed in parallel.
+    /// </summary>
+    internal static class ResourceCompression {
+
+        #region --Client API--
+        /// <summary>
+        /// Uncompressed block size in bytes.
+        /// </summary>
+        public const int BlockSize = 4 << 20;
+
+        /// <summary>
+        /// Compressed resource file extension.
+        /// </summary>
+        public const string Extension = @".fxnz";
+
+        /// <summary>
+        /// Create a stream which compresses data written to it into a destination stream.
+        /// The index is written when the stream is disposed.
+        /// </summary>
+        /// <param name="destination">Destination stream.</param>
+        /// <returns>Compression stream.</returns>
+        public static Stream CreateWriter (Stream destination) => new Writer(destination);
+
+        /// <summary>
+        /// Decompress a compressed resource into a destination stream.
+        /// </summary>
+        /// <param name="source">Compressed resource path.</param>
+        /// <param name="destination">Destination stream.</param>
+        public static async Task Decompress (string source, Stream destination) {
+            var blocks = ReadIndex(source);
+            var batchSize = Math.Max(1, Environment.ProcessorCount);
+            for (var start = 0; start < blocks.Length; start += batchSize) {
+                var batch = blocks.Skip(start).Take(batchSize);
+                var data = await Task.WhenAll(batch.Select(block => Task.Run(() => ReadBlock(source, block))));
+                foreach (var block in data)
+                    await destination.WriteAsync(block, 0, block.Length);
+            }
+        }
+
+        /// <summary>
+        /// Open a compressed resource for reading its uncompressed data from a given offset.
+        /// Only the blocks from the one containing the offset onwards are decompressed.
+        /// </summary>
+        /// <param name="source">Compressed resource path.</param>
+        /// <param name="offset">Offset into the uncompressed data.</param>
+        /// <returns>Read-only stream of uncompressed data.</returns>
+        public static Stream OpenRead (string source, long offset) => new Reader(source, ReadIndex(source), offset);
+        #endregion
+
+
+        #region --Operations--
+        private const int Magic = 0x5A4E5846; // FXNZ
+        private const int FooterSize = sizeof(long) + sizeof(int) + sizeof(int);
+        private const int BlockIndexSize = sizeof(long) + sizeof(int) + sizeof(int);
+
+        private readonly struct Block {
+            public readonly long offset;
+            public readonly int compressedSize;
+            public readonly int size;
+
+            public Block (long offset, int compressedSize, int size) {
+                this.offset = offset;
+                this.compressedSize = compressedSize;
+                this.size = size;
+            }
+        }
+
+        private static Block[] ReadIndex (string path) {
+            using var stream = File.OpenRead(path);
+            using var reader = new BinaryReader(stream);
+            // Footer
+            if (stream.Length < FooterSize)
+                throw new InvalidDataException($"Cannot read compressed resource at {path} because it is truncated");
+            stream.Seek(-FooterSize, SeekOrigin.End);
+            var indexOffset = reader.ReadInt64();
+            var count = reader.ReadInt32();
+            if (reader.ReadInt32() != Magic)
+                throw new InvalidDataException($"Cannot read compressed resource at {path} because it is not a compressed resource");
+            // Check the index against the file size before trusting it
+            var indexSize = stream.Length - FooterSize - indexOffset;
+            if (indexOffset < 0 || count < 0 || indexSize != (long)count * BlockIndexSize)
+                throw new InvalidDataException($"Cannot read compressed resource at {path} because its index is corrupt");
+            // Index
+            stream.Seek(indexOffset, SeekOrigin.Begin);
+            var blocks = new Block[count];
+            for (var idx = 0; idx < count; ++idx) {
+                var block = new Block(reader.ReadInt64(), reader.ReadInt32(), reader.ReadInt32());
+                if (block.offset < 0 || block.compressedSize < 0 || block.offset + block.compressedSize > indexOffset || block.size < 0 || block.size > BlockSize)
+                    throw new InvalidDataException($"Cannot read compressed resource at {path} because block {idx} is corrupt");
+                blocks[idx] = block;
+            }
+            return blocks;
+        }
+
+        private static byte[] ReadBlock (string path, Block block) {
+            using var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read);
+            stream.Seek(block.offset, SeekOrigin.Begin);
+            using var deflate = new DeflateStream(stream, CompressionMode.Decompress);
+            var data = new byte[block.size];
+            var offset = 0;
+            while (offset < data.Length) {
+                var bytesRead = deflate.Read(data, offset, data.Length - offset);
+                if (bytesRead == 0)
+                    throw new InvalidDataException($"Cannot read compressed resource at {path} because a block is truncated");
+                offset += bytesRead;
+            }
+            return data;
+        }
+
+        private sealed class Reader : Stream {
+
+            private readonly string path;
+            private readonly Block[] blocks;
+            private int blockIdx;
+            private byte[] data;
+            private int dataOffset;
+            private long position;
+
+            public Reader (string path, Block[] blocks, long offset) {
+                this.path = path;
+                this.blocks = blocks;
+                this.data = Array.Empty<byte>();
+                // Find the block containing the offset
+                var start = 0L;
+                while (blockIdx < blocks.Length && start + blocks[blockIdx].size <= offset)
+                    start += blocks[blockIdx++].size;
+                if (offset < 0 || (blockIdx == blocks.Length && offset > start))
+                    throw new ArgumentOutOfRangeException(nameof(offset));
+                if (blockIdx < blocks.Length) {
+                    data = ReadBlock(path, blocks[blockIdx++]);
+                    dataOffset = (int)(offset - start);
+                }
+                position = offset;
+            }
+
+            public override bool CanRead => true;
+            public override bool CanSeek => false;
+            public override bool CanWrite => false;
+            public override long Length => blocks.Sum(block => (long)block.size);
+            public override long Position { get => position; set => throw new NotSupportedException(); }
+
+            public override int Read (byte[] buffer, int offset, int count) {
+                while (dataOffset == data.Length && blockIdx < blocks.Length) {
+                    data = ReadBlock(path, blocks[blockIdx++]);
+                    dataOffset = 0;
+                }
+                var size = Math.Min(count, data.Length - dataOffset);
+                Buffer.BlockCopy(data, dataOffset, buffer, offset, size);
+                dataOffset += size;
+                position += size;
+                return size;
+            }
+
+            public override void Flush () { }
+            public override long Seek (long offset, SeekOrigin origin) => throw new NotSupportedException();
+            public override void SetLength (long value) => throw new NotSupportedException();
+            public override void Write (byte[] buffer, int offset, int count) => throw new NotSupportedException();
+        }
+
+        private sealed class Writer : Stream {
+
+            private readonly Stream destination;
+            private readonly byte[] buffer;
+            private readonly List<Block> blocks;
+            private int length;
+            private long position;
+            private bool disposed;
+
+            public Writer (Stream destination) {
+                this.destination = destination;
+                this.buffer = new byte[BlockSize];
+                this.blocks = new List<Block>();
+            }
+
+            public override bool CanRead => false;
+            public override bool CanSeek => false;
+            public override bool CanWrite => true;
+            public override long Length => position;
+            public override long Position { get => position; set => throw new NotSupportedException(); }
+
+            public override void Write (byte[] data, int offset, int count) {
+                while (count > 0) {
+                    var size = Math.Min(count, buffer.Length - length);
+                    Buffer.BlockCopy(data, offset, buffer, length, size);
+                    length += size;
+                    position += size;
+                    offset += size;
+                    count -= size;
+                    if (length == buffer.Length)
+                        WriteBlock();
+                }
+            }
+
+            public override void Flush () { }
+            public override int Read (byte[] buffer, int offset, int count) => throw new NotSupportedException();
+            public override long Seek (long offset, SeekOrigin origin) => throw new NotSupportedException();
+            public override void SetLength (long value) => throw new NotSupportedException();
+
+            protected override void Dispose (bool disposing) {
+                if (disposing && !disposed) {
+                    disposed = true;
+                    if (length > 0)
+                        WriteBlock();
+                    // Index
+                    var indexOffset = destination.Position;
+                    using var writer = new BinaryWriter(destination, System.Text.Encoding.UTF8, true);
+                    foreach (var block in blocks) {
+                        writer.Write(block.offset);
+                        writer.Write(block.compressedSize);
+                        writer.Write(block.size);
+                    }
+                    // Footer
+                    writer.Write(indexOffset);
+                    writer.Write(blocks.Count);
+                    writer.Write(Magic);
+                }
+                base.Dispose(disposing);
+            }
+
+            private void WriteBlock () {
+                var offset = destination.Position;
+                using (var deflate = new DeflateStream(destination, CompressionLevel.Optimal, true))
+                    deflate.Write(buffer, 0, length);
+                blocks.Add(new Block(offset, (int)(destination.Position - offset), length));
+                length = 0;
+            }
+        }
+        #endregion
+    }
+}
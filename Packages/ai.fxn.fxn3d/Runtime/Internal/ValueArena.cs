@@ -0,0 +1,167 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Internal {
+
+    using System;
+    using System.Buffers;
+    using System.Collections.Generic;
+    using System.Linq;
+    using System.Runtime.InteropServices;
+
+    /// <summary>
+    /// Native memory arena for marshaling prediction input values.
+    /// Allocations are 64-byte aligned so that they can be consumed by SIMD kernels,
+    /// and the arena is reused across predictions so that steady-state marshaling does not allocate.
+    /// </summary>
+    internal sealed unsafe class ValueArena : IDisposable {
+
+        #region --Client API--
+        /// <summary>
+        /// Allocation alignment in bytes.
+        /// </summary>
+        public const int Alignment = 64;
+
+        /// <summary>
+        /// Chunks at least this large are aligned to and backed by transparent huge pages where supported.
+        /// </summary>
+        public const int HugePageSize = 2 << 20;
+
+        /// <summary>
+        /// Total arena capacity in bytes.
+        /// </summary>
+        public long Capacity => chunks.Sum(chunk => chunk.capacity);
+
+        /// <summary>
+        /// Create an arena.
+        /// </summary>
+        public ValueArena () {
+            this.chunks = new List<Chunk>();
+            this.pins = new List<MemoryHandle>();
+            this.buffers = new List<SafeBuffer>();
+        }
+
+        /// <summary>
+        /// Allocate aligned memory from the arena.
+        /// The memory remains valid until the arena is reset or disposed.
+        /// </summary>
+        /// <param name="size">Allocation size in bytes.</param>
+        /// <returns>Pointer to allocated memory.</returns>
+        public void* Allocate (long size) {
+            size = (size + Alignment - 1) & ~(long)(Alignment - 1);
+            var chunk = chunks.Count > 0 ? chunks[chunks.Count - 1] : null;
+            if (chunk == null || chunk.used + size > chunk.capacity) {
+                chunk = new Chunk(Math.Max(size, MinChunkSize));
+                chunks.Add(chunk);
+            }
+            var result = chunk.data + chunk.used;
+            chunk.used += size;
+            return result;
+        }
+
+        /// <summary>
+        /// Pin managed memory until the arena is reset or disposed, so that values can borrow it without copying.
+        /// </summary>
+        /// <param name="memory">Memory to pin.</param>
+        /// <returns>Pointer to pinned memory.</returns>
+        public void* Pin (ReadOnlyMemory<byte> memory) {
+            var handle = memory.Pin();
+            pins.Add(handle);
+            return handle.Pointer;
+        }
+
+        /// <summary>
+        /// Acquire a pointer to a native buffer, like a memory-mapped view, until the arena is reset or disposed.
+        /// </summary>
+        /// <param name="buffer">Native buffer.</param>
+        /// <returns>Pointer to the start of the buffer.</returns>
+        public byte* Acquire (SafeBuffer buffer) {
+            byte* pointer = null;
+            buffer.AcquirePointer(ref pointer);
+            buffers.Add(buffer);
+            return pointer;
+        }
+
+        /// <summary>
+        /// Reset the arena, invalidating all previous allocations.
+        /// If the arena grew past its first chunk, the chunks are coalesced into a single chunk.
+        /// </summary>
+        public void Reset () {
+            Release();
+            if (chunks.Count > 1) {
+                var capacity = Capacity;
+                FreeChunks();
+                chunks.Add(new Chunk(capacity));
+            }
+            else if (chunks.Count == 1)
+                chunks[0].used = 0;
+        }
+
+        /// <summary>
+        /// Release the arena memory.
+        /// </summary>
+        public void Dispose () {
+            Release();
+            FreeChunks();
+            GC.SuppressFinalize(this);
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly List<Chunk> chunks;
+        private readonly List<MemoryHandle> pins;
+        private readonly List<SafeBuffer> buffers;
+        private const long MinChunkSize = 64 << 10;
+
+        // Pins and buffers refer to other finalizable objects, so the finalizer only frees the arena's own memory
+        ~ValueArena () => FreeChunks();
+
+        private void Release () {
+            foreach (var pin in pins)
+                pin.Dispose();
+            foreach (var buffer in buffers)
+                buffer.ReleasePointer();
+            pins.Clear();
+            buffers.Clear();
+        }
+
+        private void FreeChunks () {
+            foreach (var chunk in chunks)
+                Marshal.FreeHGlobal(chunk.handle);
+            chunks.Clear();
+        }
+
+        private sealed class Chunk {
+
+            public readonly IntPtr handle;
+            public readonly byte* data;
+            public readonly long capacity;
+            public long used;
+
+            public Chunk (long capacity) {
+                var alignment = capacity >= HugePageSize ? HugePageSize : Alignment;
+                this.capacity = capacity;
+                this.handle = Marshal.AllocHGlobal(new IntPtr(capacity + alignment));
+                this.data = (byte*)(((long)handle + alignment - 1) & ~(long)(alignment - 1));
+                this.used = 0;
+                #if UNITY_ANDROID || UNITY_STANDALONE_LINUX || UNITY_EDITOR_LINUX
+                if (alignment == HugePageSize)
+                    madvise(data, new UIntPtr((ulong)capacity), MADV_HUGEPAGE);
+                #endif
+            }
+        }
+
+        #if UNITY_ANDROID || UNITY_STANDALONE_LINUX || UNITY_EDITOR_LINUX
+        private const int MADV_HUGEPAGE = 14;
+
+        [DllImport(@"libc", EntryPoint = @"madvise")]
+        private static extern int madvise (void* address, UIntPtr length, int advice);
+        #endif
+        #endregion
+    }
+}
@@ -0,0 +1,149 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Internal {
+
+    using System;
+    using System.Buffers.Binary;
+    using System.Runtime.CompilerServices;
+
+    /// <summary>
+    /// Incremental XXH64 hash.
+    /// This is used to cheaply revalidate files in the predictor resource cache.
+    /// </summary>
+    internal sealed class XXHash64 {
+
+        #region --Client API--
+        /// <summary>
+        /// Create an XXH64 hash.
+        /// </summary>
+        /// <param name="seed">Hash seed.</param>
+        public XXHash64 (ulong seed = 0) {
+            this.seed = seed;
+            this.buffer = new byte[StripeSize];
+            Reset();
+        }
+
+        /// <summary>
+        /// Append data to the hash.
+        /// </summary>
+        /// <param name="data">Data.</param>
+        /// <param name="offset">Data offset.</param>
+        /// <param name="count">Number of bytes to append.</param>
+        public void Append (byte[] data, int offset, int count) => Append(new ReadOnlySpan<byte>(data, offset, count));
+
+        /// <summary>
+        /// Append data to the hash.
+        /// </summary>
+        /// <param name="data">Data.</param>
+        public void Append (ReadOnlySpan<byte> data) {
+            length += (ulong)data.Length;
+            // Fill buffered stripe
+            if (buffered > 0) {
+                var size = Math.Min(data.Length, StripeSize - buffered);
+                data.Slice(0, size).CopyTo(buffer.AsSpan(buffered));
+                buffered += size;
+                data = data.Slice(size);
+                if (buffered < StripeSize)
+                    return;
+                ConsumeStripe(buffer);
+                buffered = 0;
+            }
+            // Consume stripes
+            while (data.Length >= StripeSize) {
+                ConsumeStripe(data);
+                data = data.Slice(StripeSize);
+            }
+            // Buffer remainder
+            data.CopyTo(buffer);
+            buffered = data.Length;
+        }
+
+        /// <summary>
+        /// Get the hash of all appended data and reset the hash.
+        /// </summary>
+        /// <returns>Hash.</returns>
+        public ulong GetHashAndReset () {
+            var hash = length >= StripeSize ?
+                RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18) :
+                seed + Prime5;
+            if (length >= StripeSize) {
+                hash = MergeRound(hash, v1);
+                hash = MergeRound(hash, v2);
+                hash = MergeRound(hash, v3);
+                hash = MergeRound(hash, v4);
+            }
+            hash += length;
+            // Remainder
+            var remainder = new ReadOnlySpan<byte>(buffer, 0, buffered);
+            while (remainder.Length >= 8) {
+                hash ^= Round(0, BinaryPrimitives.ReadUInt64LittleEndian(remainder));
+                hash = RotateLeft(hash, 27) * Prime1 + Prime4;
+                remainder = remainder.Slice(8);
+            }
+            if (remainder.Length >= 4) {
+                hash ^= BinaryPrimitives.ReadUInt32LittleEndian(remainder) * Prime1;
+                hash = RotateLeft(hash, 23) * Prime2 + Prime3;
+                remainder = remainder.Slice(4);
+            }
+            foreach (var value in remainder) {
+                hash ^= value * Prime5;
+                hash = RotateLeft(hash, 11) * Prime1;
+            }
+            // Avalanche
+            hash ^= hash >> 33;
+            hash *= Prime2;
+            hash ^= hash >> 29;
+            hash *= Prime3;
+            hash ^= hash >> 32;
+            Reset();
+            return hash;
+        }
+        #endregion
+
+
+        #region --Operations--
+        private const int StripeSize = 32;
+        private const ulong Prime1 = 11400714785074694791UL;
+        private const ulong Prime2 = 14029467366897019727UL;
+        private const ulong Prime3 = 1609587929392839161UL;
+        private const ulong Prime4 = 9650029242287828579UL;
+        private const ulong Prime5 = 2870177450012600261UL;
+        private readonly ulong seed;
+        private readonly byte[] buffer;
+        private ulong v1, v2, v3, v4;
+        private ulong length;
+        private int buffered;
+
+        private void Reset () {
+            v1 = seed + Prime1 + Prime2;
+            v2 = seed + Prime2;
+            v3 = seed;
+            v4 = seed - Prime1;
+            length = 0;
+            buffered = 0;
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private void ConsumeStripe (ReadOnlySpan<byte> stripe) {
+            v1 = Round(v1, BinaryPrimitives.ReadUInt64LittleEndian(stripe));
+            v2 = Round(v2, BinaryPrimitives.ReadUInt64LittleEndian(stripe.Slice(8)));
+            v3 = Round(v3, BinaryPrimitives.ReadUInt64LittleEndian(stripe.Slice(16)));
+            v4 = Round(v4, BinaryPrimitives.ReadUInt64LittleEndian(stripe.Slice(24)));
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static ulong Round (ulong accumulator, ulong input) => RotateLeft(accumulator + input * Prime2, 31) * Prime1;
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static ulong MergeRound (ulong accumulator, ulong value) => (accumulator ^ Round(0, value)) * Prime1 + Prime4;
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static ulong RotateLeft (ulong value, int offset) => (value << offset) | (value >> (64 - offset));
+        #endregion
+    }
+}
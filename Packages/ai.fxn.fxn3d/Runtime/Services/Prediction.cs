@@ -10,12 +10,17 @@ namespace Function.Services {
     using System;
     using System.Threading;
     using System.Collections;
+    using System.Collections.Concurrent;
     using System.Collections.Generic;
+    using System.Diagnostics.CodeAnalysis;
+    using System.Globalization;
     using System.Linq;
     using System.IO;
+    using System.IO.MemoryMappedFiles;
     using System.Runtime.CompilerServices;
     using System.Runtime.InteropServices;
     using System.Runtime.Serialization;
+    using System.Security.Cryptography;
     using System.Text;
     using System.Threading.Tasks;
     using Newtonsoft.Json;
@@ -33,6 +38,18 @@ namespace Function.Services {
     public sealed class PredictionService {
 
         #region --Client API--
+        /// <summary>
+        /// Store predictor resources compressed in the cache.
+        /// This reduces the disk footprint of the cache, at the cost of decompressing resources each time a predictor is loaded.
+        /// Decompressed resources are removed when the predictor is deleted.
+        /// </summary>
+        public bool compressCache { get; set; }
+
+        /// <summary>
+        /// Whether to retrieve logs from edge predictions.
+        /// Disable this in production to skip copying logs out of the runtime after every prediction.
+        /// </summary>
+        public bool collectLogs { get; set; } = true;
 
         /// <summary>
         /// Create a prediction.
@@ -58,11 +75,16 @@ namespace Function.Services {
             bool async = false
         ) {
             await FunctionUtils.Initialization;
-            // Check cache
-            if (cache.TryGetValue(tag, out var p) && !rawOutputs)
+            // Check cache.
+            // Without inputs, the prediction descriptor is requested even if the predictor is loaded.
+            if (!rawOutputs && inputs != null && TryAcquire(tag, out var p))
             {
-                return async ? await PredictAsync(tag, p, inputs!)
-                    : Predict(tag, p, inputs!);
+                try {
+                    return async ? await PredictAsync(tag, p, inputs)
+                        : Predict(tag, p, inputs);
+                } finally {
+                    p.Release();
+                }
             }
             
             // Collect inputs
@@ -86,15 +108,18 @@ namespace Function.Services {
             if (rawOutputs || prediction.type != PredictorType.Edge)
                 return prediction;
             // Load
-            var predictor = await Load(prediction, acceleration, device);
-            cache.Add(prediction.tag, predictor);
+            var predictor = await Acquire(prediction, acceleration, device);
             // Return
-            if (inputs == null)
-            {
-                return prediction;
+            try {
+                if (inputs == null)
+                {
+                    return prediction;
+                }
+                return async ? await PredictAsync(tag, predictor, inputs) 
+                    : Predict(tag, predictor, inputs);
+            } finally {
+                predictor.Release();
             }
-            return async ? await PredictAsync(tag, predictor, inputs) 
-                : Predict(tag, predictor, inputs);
         }
 
         /// <summary>
@@ -118,9 +143,15 @@ namespace Function.Services {
         ) {
             await FunctionUtils.Initialization;
             // Check cache
-            if (cache.TryGetValue(tag, out var p) && !rawOutputs) {
-                yield return async ? await PredictAsync(tag, p, inputs!) 
-                    : Predict(tag, p, inputs!);
+            if (!rawOutputs && inputs != null && TryAcquire(tag, out var p)) {
+                Prediction result;
+                try {
+                    result = async ? await PredictAsync(tag, p, inputs) 
+                        : Predict(tag, p, inputs);
+                } finally {
+                    p.Release();
+                }
+                yield return result;
                 yield break;
             }
             // Collect inputs
@@ -147,32 +178,179 @@ namespace Function.Services {
                     continue;
                 }
                 // Load
-                var predictor = await Load(prediction, acceleration, device);
-                cache.Add(prediction.tag, predictor);
+                var predictor = await Acquire(prediction, acceleration, device);
                 if (inputs == null)
                 {
+                    predictor.Release();
                     yield return prediction;
+                    continue;
                 }
                 // Yield
-                yield return async ? await PredictAsync(tag, predictor, inputs!) 
-                    : Predict(tag, predictor, inputs!);
+                Prediction result;
+                try {
+                    result = async ? await PredictAsync(tag, predictor, inputs) 
+                        : Predict(tag, predictor, inputs);
+                } finally {
+                    predictor.Release();
+                }
+                yield return result;
+            }
+        }
+
+        /// <summary>
+        /// Create a prediction by running a pipeline of edge predictors.
+        /// Intermediate values are moved between predictors natively, and independent stages run in parallel.
+        /// </summary>
+        /// <param name="pipeline">Prediction pipeline.</param>
+        /// <param name="inputs">Pipeline input values.</param>
+        /// <param name="acceleration">Prediction acceleration.</param>
+        /// <param name="device">Prediction device. Do not set this unless you know what you are doing.</param>
+        /// <returns>Prediction from the last pipeline stage, or from the first stage that failed.</returns>
+        public async Task<Prediction> Create (
+            Pipeline pipeline,
+            Dictionary<string, object?> inputs,
+            Acceleration acceleration = default,
+            IntPtr device = default
+        ) {
+            await FunctionUtils.Initialization;
+            // Check
+            if (pipeline.stages.Count == 0)
+                throw new ArgumentException(@"Cannot create pipeline prediction because pipeline has no stages", nameof(pipeline));
+            // Acquire predictors
+            var predictors = new Dictionary<string, PredictorReference>();
+            try {
+                foreach (var tag in pipeline.stages.Select(stage => stage.tag).Distinct()) {
+                    var predictor = await AcquireEdge(tag, acceleration, device);
+                    if (predictor == null)
+                        throw new InvalidOperationException($"Cannot create pipeline prediction because predictor {tag} is not an edge predictor");
+                    predictors.Add(tag, predictor);
+                }
+                // Check bindings
+                foreach (var stage in pipeline.stages)
+                    CheckInputs(stage.tag, predictors[stage.tag].signature, stage.inputs.Keys);
+                return await Predict(pipeline, inputs, predictors);
+            } finally {
+                foreach (var predictor in predictors.Values)
+                    predictor.Release();
             }
         }
 
+        /// <summary>
+        /// Create a prediction session for an edge predictor.
+        /// Session inputs are marshaled once and reused by every prediction created with the session.
+        /// </summary>
+        /// <param name="tag">Predictor tag. This MUST be an `EDGE` predictor.</param>
+        /// <param name="inputs">Persistent input values. More inputs can be bound to the session later.</param>
+        /// <param name="acceleration">Prediction acceleration.</param>
+        /// <param name="device">Prediction device. Do not set this unless you know what you are doing.</param>
+        /// <returns>Prediction session. Dispose the session to release its persistent inputs.</returns>
+        public async Task<PredictionSession> CreateSession (
+            string tag,
+            Dictionary<string, object?>? inputs = null,
+            Acceleration acceleration = default,
+            IntPtr device = default
+        ) {
+            await FunctionUtils.Initialization;
+            // Load
+            var predictor = await AcquireEdge(tag, acceleration, device);
+            if (predictor == null)
+                throw new InvalidOperationException($"Cannot create prediction session because predictor {tag} is not an edge predictor");
+            predictor.Release();
+            // Bind
+            var session = new PredictionSession(tag);
+            try {
+                foreach (var pair in inputs ?? new())
+                    session.Bind(pair.Key, pair.Value);
+            } catch {
+                session.Dispose();
+                throw;
+            }
+            return session;
+        }
+
+        /// <summary>
+        /// Create a prediction with a prediction session.
+        /// Inputs that are provided here take precedence over persistent session inputs with the same name.
+        /// </summary>
+        /// <param name="session">Prediction session.</param>
+        /// <param name="inputs">Input values which change between predictions.</param>
+        /// <param name="acceleration">Prediction acceleration. This only applies if the predictor must be reloaded.</param>
+        /// <param name="device">Prediction device. Do not set this unless you know what you are doing.</param>
+        /// <param name="async">Determines whether this is asynchronous.</param>
+        public async Task<Prediction> Create (
+            PredictionSession session,
+            Dictionary<string, object?>? inputs = null,
+            Acceleration acceleration = default,
+            IntPtr device = default,
+            bool async = false
+        ) {
+            await FunctionUtils.Initialization;
+            // Acquire
+            var predictor = await AcquireEdge(session.tag, acceleration, device);
+            if (predictor == null)
+                throw new InvalidOperationException($"Cannot create prediction because predictor {session.tag} is not an edge predictor");
+            // Predict
+            try {
+                inputs ??= new();
+                return async ? await PredictAsync(session.tag, predictor, inputs, session) :
+                    Predict(session.tag, predictor, inputs, session);
+            } finally {
+                predictor.Release();
+            }
+        }
+
+        /// <summary>
+        /// Reload an edge predictor without interrupting predictions.
+        /// The latest predictor version is loaded while the current version keeps serving predictions,
+        /// then the current version is replaced atomically and released once its in-flight predictions complete.
+        /// </summary>
+        /// <param name="tag">Predictor tag.</param>
+        /// <param name="acceleration">Prediction acceleration.</param>
+        /// <param name="device">Prediction device. Do not set this unless you know what you are doing.</param>
+        /// <param name="client">Function client identifier. Specify this to override the current client identifier.</param>
+        /// <param name="configuration">Configuration identifier. Specify this to override the current client configuration token.</param>
+        public async Task Reload (
+            string tag,
+            Acceleration acceleration = default,
+            IntPtr device = default,
+            string? client = default,
+            string? configuration = default
+        ) {
+            await FunctionUtils.Initialization;
+            // Query
+            var prediction = await fxn.Request<Prediction>(
+                @"POST",
+                $"/predict/{tag}?rawOutputs=true",
+                null,
+                new () {
+                    [@"fxn-client"] = client ?? ClientId,
+                    [@"fxn-configuration-token"] = configuration ?? ConfigurationId,
+                }
+            );
+            // Check
+            if (prediction!.type != PredictorType.Edge)
+                throw new InvalidOperationException($"Cannot reload predictor {tag} because it is not an edge predictor");
+            // Load
+            var predictor = await loader(prediction, acceleration, device);
+            // Swap
+            Swap(prediction.tag, predictor);
+        }
+
         /// <summary>
         /// Delete an edge predictor that is loaded in memory.
         /// </summary>
         /// <param name="tag">Predictor tag.</param>
         /// <returns>Whether the edge predictor was successfully deleted from memory.</returns>
+        /// <remarks>
+        /// In-flight predictions with the predictor complete before it is released.
+        /// </remarks>
         public async Task<bool> Delete (string tag) {
             await FunctionUtils.Initialization;
-            // Check
-            if (!cache.TryGetValue(tag, out var predictor))
+            // Pop
+            if (!cache.TryRemove(tag, out var predictor))
                 return false;
             // Release
-            predictor.ReleasePredictor().Throw();
-            // Pop
-            cache.Remove(tag);
+            predictor.Release();
             // Return
             return true;
         }
@@ -190,6 +368,7 @@ namespace Function.Services {
             var stream = await storage.Download(value.data!);
             // Switch
             switch (value.type) {
+                case Dtype.Float16: return ToObject(stream.ToArray<ushort>(), value.shape!);
                 case Dtype.Float32: return ToObject<float>(stream, value.shape!);
                 case Dtype.Float64: return ToObject<double>(stream, value.shape!);
                 case Dtype.Int8:    return ToObject<sbyte>(stream, value.shape!);
@@ -250,21 +429,23 @@ namespace Function.Services {
             uint[]          x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Uint32, shape = new [] { x.Length } },
             ulong[]         x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Uint64, shape = new [] { x.Length } },
             bool[]          x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Bool, shape = new [] { x.Length } },
-            Tensor<float>   x => new Value { data = await storage.Upload(name, x.data.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Float32, shape = x.shape },
-            Tensor<double>  x => new Value { data = await storage.Upload(name, x.data.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Float64, shape = x.shape },
-            Tensor<sbyte>   x => new Value { data = await storage.Upload(name, x.data.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Int8, shape = x.shape },
-            Tensor<short>   x => new Value { data = await storage.Upload(name, x.data.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Int16, shape = x.shape },
-            Tensor<int>     x => new Value { data = await storage.Upload(name, x.data.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Int32, shape = x.shape },
-            Tensor<long>    x => new Value { data = await storage.Upload(name, x.data.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Int64, shape = x.shape },
-            Tensor<byte>    x => new Value { data = await storage.Upload(name, x.data.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Uint8, shape = x.shape },
-            Tensor<ushort>  x => new Value { data = await storage.Upload(name, x.data.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Uint16, shape = x.shape },
-            Tensor<uint>    x => new Value { data = await storage.Upload(name, x.data.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Uint32, shape = x.shape },
-            Tensor<ulong>   x => new Value { data = await storage.Upload(name, x.data.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Uint64, shape = x.shape },
+            Tensor<float>   x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Float32, shape = x.shape },
+            Tensor<double>  x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Float64, shape = x.shape },
+            Tensor<sbyte>   x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Int8, shape = x.shape },
+            Tensor<short>   x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Int16, shape = x.shape },
+            Tensor<int>     x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Int32, shape = x.shape },
+            Tensor<long>    x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Int64, shape = x.shape },
+            Tensor<byte>    x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Uint8, shape = x.shape },
+            Tensor<ushort>  x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Uint16, shape = x.shape },
+            Tensor<uint>    x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Uint32, shape = x.shape },
+            Tensor<ulong>   x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, dataUrlLimit: minUploadSize, key: key), type = Dtype.Uint64, shape = x.shape },
             string          x => new Value { data = await storage.Upload(name, x.ToStream(), UploadType.Value, mime: @"text/plain", dataUrlLimit: minUploadSize, key: key), type = Dtype.String },
             IList           x => new Value { data = await storage.Upload(name, JsonConvert.SerializeObject(x).ToStream(), UploadType.Value, mime: @"application/json", dataUrlLimit: minUploadSize, key: key), type = Dtype.List },
             IDictionary     x => new Value { data = await storage.Upload(name, JsonConvert.SerializeObject(x).ToStream(), UploadType.Value, mime: @"application/json", dataUrlLimit: minUploadSize, key: key), type = Dtype.Dict },
             Image           x => await ToValue(x, name, minUploadSize: minUploadSize, key: key),
             Stream          x => new Value { data = await storage.Upload(name, x, UploadType.Value, mime: mime, dataUrlLimit: minUploadSize, key: key), type = type ?? Dtype.Binary },
+            ReadOnlyMemory<byte> x => await ToValue(x.ToStream(), name, type: type, minUploadSize: minUploadSize, mime: mime, key: key),
+            Memory<byte>    x => await ToValue(((ReadOnlyMemory<byte>)x).ToStream(), name, type: type, minUploadSize: minUploadSize, mime: mime, key: key),
             Enum            x => await ToValue(SerializeEnum(x), name, minUploadSize: minUploadSize, mime: mime, key: key),
             _                 => throw new InvalidOperationException($"Cannot create a Function value from value '{value}' of type `{value.GetType()}`"),
         };
@@ -274,9 +455,21 @@ namespace Function.Services {
         #region --Operations--
         private readonly FunctionClient fxn;
         private readonly StorageService storage;
+        private readonly PredictorService predictors;
         private readonly string cachePath;
-        private readonly Dictionary<string, IntPtr> cache;
+        private readonly ConcurrentDictionary<string, PredictorReference> cache;
+        private readonly ConcurrentDictionary<string, Lazy<Task>> loads;
+        // Tests replace the loader, as they cannot create native predictors
+        internal Func<Prediction, Acceleration, IntPtr, Task<PredictorReference>> loader;
+        private readonly ConcurrentBag<ValueArena> arenas;
+        private const long MaxPooledArenaCapacity = 16 << 20;
         private readonly List<string> ResourceTypes = new () { @"bin", @"dso" };
+        private const int ChunkDownloadConcurrency = 4;
+        private const string CacheRecordExtension = @".xxh64";
+        private const string ChunkManifestExtension = @".chunks";
+        private static readonly TimeSpan StaleTransientAge = TimeSpan.FromDays(1);
+        private static readonly ConcurrentDictionary<string, Task<bool>> Validations = new ();
+        private static readonly ConcurrentDictionary<string, Task> Revalidations = new ();
 
         private static string ConfigurationId {
             get {
@@ -297,19 +490,28 @@ namespace Function.Services {
         internal PredictionService (
             FunctionClient client,
             StorageService storage,
+            PredictorService predictors,
             string? cachePath
         ) {
             this.fxn = client;
             this.storage = storage;
+            this.predictors = predictors;
             this.cachePath = cachePath ?? Path.Combine(
                 Environment.GetFolderPath(Environment.SpecialFolder.UserProfile),
                 ".fxn",
                 "cache"
             );
-            this.cache = new Dictionary<string, IntPtr>();
+            this.cache = new ConcurrentDictionary<string, PredictorReference>();
+            this.loads = new ConcurrentDictionary<string, Lazy<Task>>();
+            this.loader = Load;
+            this.arenas = new ConcurrentBag<ValueArena>();
+            // Revalidate each cache directory once per process, no matter how many clients share it
+            Revalidations.GetOrAdd(Path.GetFullPath(this.cachePath), path => Task.Run(() => RevalidateCache(path)));
         }
 
-        private async Task<IntPtr> Load (Prediction prediction, Acceleration acceleration, IntPtr device) {
+        private async Task<PredictorReference> Load (Prediction prediction, Acceleration acceleration, IntPtr device) {
+            // Retrieve signature while resources are loading
+            var signature = RetrieveSignature(prediction.tag);
             // Create configuration
             Function.CreateConfiguration(out var configuration).Throw();
             configuration.SetConfigurationTag(prediction.tag).Throw();
@@ -317,39 +519,43 @@ namespace Function.Services {
             configuration.SetConfigurationAcceleration(acceleration).Throw();
             configuration.SetConfigurationDevice(device).Throw();
             // Add resources
+            var expandedPaths = new List<string>();
             foreach (var resource in prediction.resources!)
-                if (ResourceTypes.Contains(resource.type))
-                    await configuration.AddConfigurationResourceAsync(
-                        resource.type,
-                        await Retrieve(resource)
-                    );
+                if (ResourceTypes.Contains(resource.type)) {
+                    var (path, expanded) = await Retrieve(resource);
+                    if (expanded)
+                        expandedPaths.Add(path);
+                    await configuration.AddConfigurationResourceAsync(resource.type, path);
+                }
             // Create predictor
             Function.CreatePredictor(configuration, out var predictor).Throw();
             configuration.ReleaseConfiguration().Throw();            
             // Return
-            return predictor;
+            return new PredictorReference(predictor, await signature, expandedPaths);
         }
 
         private async Task<Prediction> PredictAsync(string tag,
-            IntPtr predictor, Dictionary<string, object?> inputs)
+            PredictorReference predictor, Dictionary<string, object?> inputs,
+            PredictionSession? session = null)
         {
             IntPtr inputMap = default;
             IntPtr prediction = default;
+            CheckInputs(tag, predictor.signature, session != null ? inputs.Keys.Union(session.bindings.Keys) : inputs.Keys);
+            var arena = RentArena();
             try
             {
                 // Marshal inputs
-                Function.CreateValueMap(out inputMap).Throw();
-                foreach (var pair in inputs)
-                    inputMap.SetValueMapValue(pair.Key, ToValue(pair.Value)).Throw();
+                inputMap = CreateInputs(inputs, session, arena);
                 var output = await CreatePredictionAsync(
-                    predictor, inputMap);
+                    predictor.predictor, inputMap);
                 output.status.Throw();
                 prediction = output.prediction;
                 return PredictInternal(tag, ref prediction);
             }
             finally
             {
-                inputMap.ReleaseValueMap();
+                ReleaseInputs(inputMap, inputs, session);
+                ReturnArena(arena);
                 if (prediction != IntPtr.Zero)
                 {
                     prediction.ReleasePrediction();
@@ -377,21 +583,23 @@ namespace Function.Services {
 
         private Prediction Predict (
             string tag,
-            IntPtr predictor,
-            Dictionary<string, object?> inputs
+            PredictorReference predictor,
+            Dictionary<string, object?> inputs,
+            PredictionSession? session = null
         ) {
             IntPtr inputMap = default;
             IntPtr prediction = default;
+            CheckInputs(tag, predictor.signature, session != null ? inputs.Keys.Union(session.bindings.Keys) : inputs.Keys);
+            var arena = RentArena();
             try {
                 // Marshal inputs
-                Function.CreateValueMap(out inputMap).Throw();
-                foreach (var pair in inputs)
-                    inputMap.SetValueMapValue(pair.Key, ToValue(pair.Value)).Throw();
+                inputMap = CreateInputs(inputs, session, arena);
                 // Predict
-                predictor.CreatePrediction(inputMap, out prediction).Throw();
+                predictor.predictor.CreatePrediction(inputMap, out prediction).Throw();
                 return PredictInternal(tag, ref prediction);
             } finally {
-                inputMap.ReleaseValueMap();
+                ReleaseInputs(inputMap, inputs, session);
+                ReturnArena(arena);
                 // Releases the prediction if valid.
                 if (prediction != IntPtr.Zero)
                 {
@@ -413,28 +621,34 @@ namespace Function.Services {
                 var error = prediction.GetPredictionError(errorBuffer, errorBuffer.Capacity) == Status.Ok ? errorBuffer.ToString() : null;
                 // Get latency and logs
                 prediction.GetPredictionLatency(out var latency);
-                prediction.GetPredictionLogLength(out var logsLength);
-                var logBuffer = new StringBuilder(logsLength + 1);
-                var logs = prediction.GetPredictionLogs(logBuffer, logBuffer.Capacity) == Status.Ok ? logBuffer.ToString() : null;  
+                string? logs = null;
+                if (collectLogs) {
+                    prediction.GetPredictionLogLength(out var logsLength);
+                    var logBuffer = new StringBuilder(logsLength + 1);
+                    logs = prediction.GetPredictionLogs(logBuffer, logBuffer.Capacity) == Status.Ok ? logBuffer.ToString() : null;
+                }
                 // Marshal outputs
                 prediction.GetPredictionResults(out var outputMap).Throw();
                 outputMap.GetValueMapSize(out var count).Throw();
-                var results = new List<object?>();
+                var results = new object?[count];
+                var names = new string[count];
                 var name = new StringBuilder(2048);
                 for (var idx = 0; idx < count; ++idx) {
                     name.Clear();
                     outputMap.GetValueMapKey(idx, name, name.Capacity).Throw();
-                    outputMap.GetValueMapValue(name.ToString(), out var value).Throw();
-                    results.Add(ToObject(value));
-                }                              
+                    names[idx] = name.ToString();
+                    outputMap.GetValueMapValue(names[idx], out var value).Throw();
+                    results[idx] = ToObject(value);
+                }
                 // Create prediction
                 return new Prediction {
                     id = id.ToString(),
                     tag = tag,
                     type = PredictorType.Edge,
                     created = DateTime.UtcNow,
-                    results = results.ToArray(),
-                    latency = latency, 
+                    results = results,
+                    resultNames = names,
+                    latency = latency,
                     error = error,
                     logs = logs,
                 };
@@ -446,19 +660,458 @@ namespace Function.Services {
             }
         }
 
-        private async Task<string> Retrieve (PredictionResource resource) {
+        private async Task<Prediction> Predict (
+            Pipeline pipeline,
+            Dictionary<string, object?> inputs,
+            Dictionary<string, PredictorReference> predictors
+        ) {
+            // Count consumers of each upstream output
+            var consumers = pipeline.stages
+                .SelectMany(stage => stage.inputs.Values)
+                .Where(binding => Pipeline.TryParseBinding(binding, out _, out _))
+                .GroupBy(binding => binding)
+                .ToDictionary(group => group.Key, group => group.Count());
+            // Run stages in dependency order
+            var predictions = new Dictionary<string, IntPtr>();
+            try {
+                var pending = pipeline.stages.ToList();
+                while (pending.Count > 0) {
+                    var ready = pending.Where(stage => stage.inputs.Values.All(binding =>
+                        !Pipeline.TryParseBinding(binding, out var upstream, out _) ||
+                        predictions.ContainsKey(upstream!)
+                    )).ToArray();
+                    var inputMaps = new List<IntPtr>();
+                    var arena = RentArena();
+                    (Status status, IntPtr prediction)[] outputs;
+                    try {
+                        foreach (var stage in ready)
+                            inputMaps.Add(CreatePipelineInputs(stage, inputs, predictions, consumers, arena));
+                        outputs = await Task.WhenAll(ready.Select((stage, idx) => CreatePredictionAsync(predictors[stage.tag].predictor, inputMaps[idx])));
+                    } finally {
+                        foreach (var inputMap in inputMaps)
+                            inputMap.ReleaseValueMap();
+                        ReturnArena(arena);
+                    }
+                    for (var idx = 0; idx < ready.Length; ++idx)
+                        if (outputs[idx].prediction != IntPtr.Zero)
+                            predictions.Add(ready[idx].name, outputs[idx].prediction);
+                    foreach (var output in outputs)
+                        output.status.Throw();
+                    // Check errors
+                    var failed = ready.FirstOrDefault(stage => HasError(predictions[stage.name]));
+                    if (failed != null) {
+                        var failedPrediction = predictions[failed.name];
+                        predictions.Remove(failed.name);
+                        return PredictInternal(failed.tag, ref failedPrediction);
+                    }
+                    pending.RemoveAll(stage => ready.Contains(stage));
+                }
+                // Marshal results
+                var last = pipeline.stages[pipeline.stages.Count - 1];
+                var prediction = predictions[last.name];
+                predictions.Remove(last.name);
+                return PredictInternal(last.tag, ref prediction);
+            } finally {
+                foreach (var prediction in predictions.Values)
+                    prediction.ReleasePrediction();
+            }
+        }
+
+        private bool TryAcquire (string tag, [NotNullWhen(true)] out PredictorReference? predictor) {
+            // A predictor that is observed while being swapped out might already be released,
+            // in which case the cache holds its replacement or nothing.
+            while (cache.TryGetValue(tag, out predictor))
+                if (predictor.TryAcquire())
+                    return true;
+            return false;
+        }
+
+        private async Task<PredictorReference> Acquire (Prediction prediction, Acceleration acceleration, IntPtr device) {
+            // Concurrent callers share a single in-flight load per tag.
+            // Loaded predictors are added to the cache before the load is removed,
+            // so callers always observe either the cached predictor or the in-flight load.
+            var tag = prediction.tag;
+            PredictorReference? predictor;
+            while (!TryAcquire(tag, out predictor)) {
+                var load = loads.GetOrAdd(tag, _ => new Lazy<Task>(async () => Swap(tag, await loader(prediction, acceleration, device))));
+                try {
+                    await load.Value;
+                } finally {
+                    ((ICollection<KeyValuePair<string, Lazy<Task>>>)loads).Remove(new KeyValuePair<string, Lazy<Task>>(tag, load));
+                }
+            }
+            return predictor;
+        }
+
+        private void Swap (string tag, PredictorReference predictor) {
+            PredictorReference? current = null;
+            cache.AddOrUpdate(tag, predictor, (_, existing) => {
+                current = existing;
+                return predictor;
+            });
+            current?.Release();
+        }
+
+        private async Task<Signature?> RetrieveSignature (string tag) {
+            // The signature is only used for validation, so edge predictors still load when it is unavailable
+            try {
+                var predictor = await predictors.Retrieve(tag);
+                return predictor?.signature;
+            } catch {
+                return null;
+            }
+        }
+
+        internal static void CheckInputs (string tag, Signature? signature, IEnumerable<string> inputs) {
+            if (signature?.inputs == null)
+                return;
+            foreach (var parameter in signature.inputs)
+                if (parameter.name != null && parameter.optional != true && parameter.defaultValue == null && !inputs.Contains(parameter.name))
+                    throw new ArgumentException($"Cannot create prediction with predictor {tag} because required input '{parameter.name}' was not provided");
+        }
+
+        private async Task<PredictorReference?> AcquireEdge (string tag, Acceleration acceleration, IntPtr device) {
+            // Check cache
+            if (TryAcquire(tag, out var predictor))
+                return predictor;
+            // Query
+            var prediction = await fxn.Request<Prediction>(
+                @"POST",
+                $"/predict/{tag}?rawOutputs=true",
+                null,
+                new () {
+                    [@"fxn-client"] = ClientId,
+                    [@"fxn-configuration-token"] = ConfigurationId,
+                }
+            );
+            // Load
+            return prediction!.type == PredictorType.Edge ? await Acquire(prediction, acceleration, device) : null;
+        }
+
+        internal static IntPtr CreateInputs (
+            Dictionary<string, object?> inputs,
+            PredictionSession? session,
+            ValueArena arena
+        ) {
+            Function.CreateValueMap(out var inputMap).Throw();
+            try {
+                foreach (var pair in inputs)
+                    inputMap.SetValueMapValue(pair.Key, ToValue(pair.Value, arena)).Throw();
+                // Lend persistent session inputs to the map
+                if (session != null)
+                    foreach (var pair in session.bindings)
+                        if (!inputs.ContainsKey(pair.Key))
+                            inputMap.SetValueMapValue(pair.Key, pair.Value).Throw();
+                return inputMap;
+            } catch {
+                ReleaseInputs(inputMap, inputs, session);
+                throw;
+            }
+        }
+
+        internal static void ReleaseInputs (
+            IntPtr inputMap,
+            Dictionary<string, object?> inputs,
+            PredictionSession? session
+        ) {
+            if (inputMap == IntPtr.Zero)
+                return;
+            // Detach persistent session inputs so that they are not released with the map
+            if (session != null)
+                foreach (var name in session.bindings.Keys)
+                    if (!inputs.ContainsKey(name))
+                        inputMap.SetValueMapValue(name, IntPtr.Zero);
+            inputMap.ReleaseValueMap();
+        }
+
+        private ValueArena RentArena () => arenas.TryTake(out var arena) ? arena : new ValueArena();
+
+        private void ReturnArena (ValueArena arena) {
+            // Release arenas that grew for a large prediction or would grow the pool past the prediction concurrency,
+            // so that a burst of predictions does not hold on to its peak memory
+            if (arena.Capacity > MaxPooledArenaCapacity || arenas.Count >= Environment.ProcessorCount) {
+                arena.Dispose();
+                return;
+            }
+            arena.Reset();
+            arenas.Add(arena);
+        }
+
+        private IntPtr CreatePipelineInputs (
+            Pipeline.Stage stage,
+            Dictionary<string, object?> inputs,
+            Dictionary<string, IntPtr> predictions,
+            Dictionary<string, int> consumers,
+            ValueArena arena
+        ) {
+            Function.CreateValueMap(out var inputMap).Throw();
+            try {
+                foreach (var pair in stage.inputs) {
+                    // Pipeline input
+                    if (!Pipeline.TryParseBinding(pair.Value, out var upstream, out var name)) {
+                        if (!inputs.TryGetValue(name, out var input))
+                            throw new ArgumentException($"Cannot create pipeline prediction because stage '{stage.name}' requires missing input '{name}'");
+                        inputMap.SetValueMapValue(pair.Key, ToValue(input, arena)).Throw();
+                        continue;
+                    }
+                    // Upstream output
+                    predictions[upstream!].GetPredictionResults(out var outputMap).Throw();
+                    if (outputMap.GetValueMapValue(name, out var value) != Status.Ok)
+                        throw new InvalidOperationException($"Cannot create pipeline prediction because stage '{upstream}' did not produce output '{name}'");
+                    // Move the value to its last consumer and copy it for every other consumer
+                    if (--consumers[pair.Value] == 0)
+                        outputMap.SetValueMapValue(name, IntPtr.Zero).Throw();
+                    else
+                        value = CloneValue(value);
+                    inputMap.SetValueMapValue(pair.Key, value).Throw();
+                }
+                return inputMap;
+            } catch {
+                inputMap.ReleaseValueMap();
+                throw;
+            }
+        }
+
+        internal async Task<(string path, bool expanded)> Retrieve (PredictionResource resource) {
             // Check cache
             Directory.CreateDirectory(cachePath);
             var name = !string.IsNullOrEmpty(resource.name) ? resource.name : GetResourceName(resource.url);
             var path = Path.Combine(cachePath, name);
-            if (File.Exists(path))
+            if (File.Exists(path) && await Validate(path))
+                return (path, false);
+            if (!compressCache) {
+                await CacheResource(resource, name, path, compress: false);
+                return (path, false);
+            }
+            // Check compressed cache before retrieving any chunks
+            var compressedPath = path + ResourceCompression.Extension;
+            if (!File.Exists(compressedPath) || !await Validate(compressedPath))
+                await CacheResource(resource, name, compressedPath, compress: true);
+            // Expand into a file owned by the loading predictor, so that replacing the predictor does not delete it from under another one
+            var expandedDirectory = Path.Combine(cachePath, @"expanded");
+            var expandedPath = Path.Combine(expandedDirectory, $"{Guid.NewGuid():N}-{name}");
+            Directory.CreateDirectory(expandedDirectory);
+            try {
+                using var stream = File.Create(expandedPath);
+                await ResourceCompression.Decompress(compressedPath, stream);
+            } catch {
+                File.Delete(expandedPath);
+                throw;
+            }
+            return (expandedPath, true);
+        }
+
+        private async Task CacheResource (PredictionResource resource, string name, string path, bool compress) {
+            // Download or assemble from chunks, verifying the resource checksum as data is written
+            var chunkDirectory = Path.Combine(cachePath, @"chunks", $"{name}.{Guid.NewGuid():N}");
+            try {
+                var chunkPaths = resource.chunks != null ? await RetrieveChunks(resource.chunks, chunkDirectory) : null;
+                await WriteCache(path, async stream => {
+                    using var compressor = compress ? ResourceCompression.CreateWriter(stream) : null;
+                    using var checksum = IncrementalHash.CreateHash(HashAlgorithmName.SHA256);
+                    var destination = compressor ?? stream;
+                    destination = resource.checksum != null ? new HashStream(destination, checksum.AppendData) : destination;
+                    if (chunkPaths == null) {
+                        using var dataStream = await fxn.Download(resource.url);
+                        await dataStream.CopyToAsync(destination);
+                    }
+                    else
+                        foreach (var chunkPath in chunkPaths) {
+                            using var chunkStream = File.OpenRead(chunkPath);
+                            await chunkStream.CopyToAsync(destination);
+                        }
+                    if (resource.checksum != null && !ToHex(checksum.GetHashAndReset()).Equals(resource.checksum, StringComparison.OrdinalIgnoreCase))
+                        throw new InvalidDataException($"Cannot retrieve resource {name} because the downloaded data does not match its checksum");
+                });
+                // Record where each chunk is located, so that later versions of the resource can reuse unchanged chunks
+                if (resource.chunks != null)
+                    WriteChunkManifest(path, resource.chunks);
+            } finally {
+                // Chunks are only staged for assembly, so that the cache does not hold every resource twice
+                if (Directory.Exists(chunkDirectory))
+                    Directory.Delete(chunkDirectory, true);
+            }
+        }
+
+        private async Task<string[]> RetrieveChunks (ResourceChunk[] chunks, string chunkPath) {
+            Directory.CreateDirectory(chunkPath);
+            // Chunks which are unchanged from a previous resource version are copied from the cached resource
+            var sources = FindChunkSources();
+            using var downloads = new SemaphoreSlim(ChunkDownloadConcurrency);
+            return await Task.WhenAll(chunks.Select(async (chunk, idx) => {
+                var path = Path.Combine(chunkPath, $"{idx}");
+                if (sources.TryGetValue(chunk.hash.ToLowerInvariant(), out var source))
+                    try {
+                        await WriteChunk(path, chunk, () => Task.FromResult(OpenChunkSource(source.path, source.offset)), bounded: true);
+                        return path;
+                    } catch (Exception ex) when (ex is IOException || ex is InvalidDataException || ex is UnauthorizedAccessException) { }
+                // Download and verify
+                await downloads.WaitAsync();
+                try {
+                    await WriteChunk(path, chunk, () => fxn.Download(chunk.url), bounded: false);
+                } finally {
+                    downloads.Release();
+                }
                 return path;
-            // Download
-            using var dataStream = await fxn.Download(resource.url);
+            }));
+        }
+
+        private static async Task WriteChunk (string path, ResourceChunk chunk, Func<Task<Stream>> open, bool bounded) {
+            // Bounded sources contain other data after the chunk, so only the chunk size is read from them
+            using var hash = IncrementalHash.CreateHash(HashAlgorithmName.SHA256);
             using var fileStream = File.Create(path);
-            dataStream.CopyTo(fileStream); // CHECK // Async usage
-            // Return
-            return path;
+            using var dataStream = await open();
+            var buffer = new byte[1 << 16];
+            var limit = bounded ? chunk.size : long.MaxValue;
+            var size = 0L;
+            int bytesRead;
+            while (size < limit && (bytesRead = await dataStream.ReadAsync(buffer, 0, (int)Math.Min(buffer.Length, limit - size))) > 0) {
+                hash.AppendData(buffer, 0, bytesRead);
+                await fileStream.WriteAsync(buffer, 0, bytesRead);
+                size += bytesRead;
+            }
+            var digest = ToHex(hash.GetHashAndReset());
+            if (size != chunk.size || !digest.Equals(chunk.hash, StringComparison.OrdinalIgnoreCase))
+                throw new InvalidDataException($"Cannot retrieve resource chunk {chunk.hash} because the data is corrupt");
+        }
+
+        private Dictionary<string, (string path, long offset)> FindChunkSources () {
+            // Chunk manifests record where each chunk of an assembled resource is located, whether it is compressed or not
+            var sources = new Dictionary<string, (string path, long offset)>();
+            foreach (var manifestPath in Directory.EnumerateFiles(cachePath, $"*{ChunkManifestExtension}")) {
+                var path = manifestPath.Substring(0, manifestPath.Length - ChunkManifestExtension.Length);
+                if (!File.Exists(path))
+                    continue;
+                try {
+                    var offset = 0L;
+                    foreach (var line in File.ReadAllLines(manifestPath)) {
+                        var entry = line.Split(' ');
+                        sources[entry[0]] = (path, offset);
+                        offset += long.Parse(entry[1]);
+                    }
+                } catch (Exception ex) when (ex is IOException || ex is FormatException || ex is IndexOutOfRangeException) { }
+            }
+            return sources;
+        }
+
+        private static Stream OpenChunkSource (string path, long offset) {
+            // Chunk offsets are into the uncompressed resource, so compressed resources are read from the block containing the offset
+            if (path.EndsWith(ResourceCompression.Extension, StringComparison.Ordinal))
+                return ResourceCompression.OpenRead(path, offset);
+            var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read);
+            stream.Seek(offset, SeekOrigin.Begin);
+            return stream;
+        }
+
+        private static void WriteChunkManifest (string path, ResourceChunk[] chunks) {
+            var tempPath = $"{path}{ChunkManifestExtension}.{Guid.NewGuid():N}.tmp";
+            File.WriteAllLines(tempPath, chunks.Select(chunk => $"{chunk.hash.ToLowerInvariant()} {chunk.size}"));
+            Publish(tempPath, path + ChunkManifestExtension, replace: true);
+        }
+
+        internal static async Task WriteCache (string path, Func<Stream, Task> write) {
+            // Write to a temporary file so that other processes sharing the cache never observe a partial file
+            var tempPath = $"{path}.{Guid.NewGuid():N}.tmp";
+            var recordPath = path + CacheRecordExtension;
+            var tempRecordPath = $"{recordPath}.{Guid.NewGuid():N}.tmp";
+            var hash = new XXHash64();
+            try {
+                using (var fileStream = File.Create(tempPath))
+                    await write(new HashStream(fileStream, hash.Append));
+                // Publish the hash record before the file, so that revalidation never observes the file without its record
+                File.WriteAllText(tempRecordPath, $"{hash.GetHashAndReset():x16} {new FileInfo(tempPath).Length}");
+                Publish(tempRecordPath, recordPath, replace: true);
+                Publish(tempPath, path, replace: false);
+            } finally {
+                if (File.Exists(tempPath))
+                    File.Delete(tempPath);
+                if (File.Exists(tempRecordPath))
+                    File.Delete(tempRecordPath);
+            }
+            Validations[Path.GetFullPath(path)] = Task.FromResult(true);
+        }
+
+        private static void Publish (string tempPath, string path, bool replace) {
+            try {
+                File.Move(tempPath, path);
+            } catch (IOException) when (File.Exists(path)) {
+                // Another process published the same file first
+                if (replace)
+                    File.Replace(tempPath, path, null);
+            }
+        }
+
+        internal static Task<bool> Validate (string path) {
+            // Files are only trusted once their contents match their hash record.
+            // Loads share the validation of each file with background revalidation, so every file is hashed at most once.
+            return Validations.GetOrAdd(Path.GetFullPath(path), fullPath => Task.Run(() => Revalidate(fullPath)));
+        }
+
+        private static async Task RevalidateCache (string cachePath) {
+            // Revalidate cached files in the background, so that corrupt files are evicted before they are needed
+            if (!Directory.Exists(cachePath))
+                return;
+            // Remove chunks and expanded resources left behind by processes that did not finish with them
+            var chunkPath = Path.Combine(cachePath, @"chunks");
+            if (Directory.Exists(chunkPath))
+                foreach (var directory in Directory.EnumerateDirectories(chunkPath).ToArray())
+                    try {
+                        if (Directory.GetLastWriteTimeUtc(directory) < DateTime.UtcNow - StaleTransientAge)
+                            Directory.Delete(directory, true);
+                    } catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException) { }
+            var expandedPath = Path.Combine(cachePath, @"expanded");
+            if (Directory.Exists(expandedPath))
+                foreach (var file in Directory.EnumerateFiles(expandedPath).ToArray())
+                    try {
+                        if (File.GetLastWriteTimeUtc(file) < DateTime.UtcNow - StaleTransientAge)
+                            File.Delete(file);
+                    } catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException) { }
+            var records = Directory.EnumerateFiles(cachePath, $"*{CacheRecordExtension}", SearchOption.AllDirectories);
+            foreach (var record in records.ToArray())
+                await Validations.GetOrAdd(record.Substring(0, record.Length - CacheRecordExtension.Length), path => Task.Run(() => Revalidate(path)));
+        }
+
+        private static bool TryReadRecord (string path, out ulong hash, out long length) {
+            hash = 0;
+            length = 0;
+            try {
+                var record = File.ReadAllText(path + CacheRecordExtension).Split(' ');
+                return record.Length == 2 && ulong.TryParse(record[0], NumberStyles.HexNumber, CultureInfo.InvariantCulture, out hash) && long.TryParse(record[1], out length);
+            } catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException) {
+                return false;
+            }
+        }
+
+        private static bool Revalidate (string path) {
+            var recordPath = path + CacheRecordExtension;
+            // Files that are not published yet, or that were cached before hashes were recorded, cannot be revalidated
+            if (!File.Exists(path))
+                return false;
+            if (!File.Exists(recordPath))
+                return true;
+            var file = new FileInfo(path);
+            var modified = file.LastWriteTimeUtc;
+            try {
+                if (TryReadRecord(path, out var expected, out var length) && file.Length == length) {
+                    var hash = new XXHash64();
+                    using var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read, 1 << 20);
+                    var buffer = new byte[1 << 20];
+                    int bytesRead;
+                    while ((bytesRead = stream.Read(buffer, 0, buffer.Length)) > 0)
+                        hash.Append(buffer, 0, bytesRead);
+                    if (hash.GetHashAndReset() == expected)
+                        return true;
+                }
+            } catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException) { }
+            // Evict, unless the file was rewritten while it was being revalidated
+            try {
+                file.Refresh();
+                if (file.Exists && file.LastWriteTimeUtc == modified) {
+                    File.Delete(path);
+                    File.Delete(recordPath);
+                }
+            } catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException) { }
+            return false;
         }
 
         private async Task<object?[]?> ParseResults (object?[]? values, bool raw) {
@@ -467,7 +1120,7 @@ namespace Function.Services {
                 return null;
             // Convert
             var results = await Task.WhenAll(values.Select(async r => {
-                var value = (r as JObject)!.ToObject<Value>();
+                var value = r as Value ?? (r as JObject)!.ToObject<Value>();
                 return raw ? value : await ToObject(value!);
             }));
             // Return
@@ -478,52 +1131,64 @@ namespace Function.Services {
 
         #region --Utilities--
 
-        internal static unsafe IntPtr ToValue (object? value) {
+        internal static unsafe IntPtr ToValue (object? value, ValueArena? arena = null) {
             switch (value) {
                 case IntPtr x:          return x;
-                case float x:           return ToValue(&x);
-                case double x:          return ToValue(&x);
-                case sbyte x:           return ToValue(&x);
-                case short x:           return ToValue(&x);   
-                case int x:             return ToValue(&x);
-                case long x:            return ToValue(&x);
-                case byte x:            return ToValue(&x);
-                case ushort x:          return ToValue(&x);
-                case uint x:            return ToValue(&x);
-                case ulong x:           return ToValue(&x);
-                case bool x:            return ToValue(&x);
-                case float[] x:         return ToValue(x);
-                case double[] x:        return ToValue(x);
-                case sbyte[] x:         return ToValue(x);
-                case short[] x:         return ToValue(x);   
-                case int[] x:           return ToValue(x);
-                case long[] x:          return ToValue(x);
-                case byte[] x:          return ToValue(x);
-                case ushort[] x:        return ToValue(x);
-                case uint[] x:          return ToValue(x);
-                case ulong[] x:         return ToValue(x);
-                case bool[] x:          return ToValue(x);
-                case Tensor<float> x:   return ToValue(x);
-                case Tensor<double> x:  return ToValue(x);
-                case Tensor<sbyte> x:   return ToValue(x);
-                case Tensor<short> x:   return ToValue(x);
-                case Tensor<int> x:     return ToValue(x);
-                case Tensor<long> x:    return ToValue(x);
-                case Tensor<byte> x:    return ToValue(x);
-                case Tensor<ushort> x:  return ToValue(x);
-                case Tensor<uint> x:    return ToValue(x);
-                case Tensor<ulong> x:   return ToValue(x);
-                case Tensor<bool> x:    return ToValue(x);
-                case Image x:           return ToValue(x);
-                case string x:          return Function.CreateStringValue(x, out var str).Throw() == Status.Ok ? str : default;
+                case float x:           return ToValue(x, arena);
+                case double x:          return ToValue(x, arena);
+                case sbyte x:           return ToValue(x, arena);
+                case short x:           return ToValue(x, arena);   
+                case int x:             return ToValue(x, arena);
+                case long x:            return ToValue(x, arena);
+                case byte x:            return ToValue(x, arena);
+                case ushort x:          return ToValue(x, arena);
+                case uint x:            return ToValue(x, arena);
+                case ulong x:           return ToValue(x, arena);
+                case bool x:            return ToValue(x, arena);
+                case float[] x:         return ToValue(x, arena);
+                case double[] x:        return ToValue(x, arena);
+                case sbyte[] x:         return ToValue(x, arena);
+                case short[] x:         return ToValue(x, arena);   
+                case int[] x:           return ToValue(x, arena);
+                case long[] x:          return ToValue(x, arena);
+                case byte[] x:          return ToValue(x, arena);
+                case ushort[] x:        return ToValue(x, arena);
+                case uint[] x:          return ToValue(x, arena);
+                case ulong[] x:         return ToValue(x, arena);
+                case bool[] x:          return ToValue(x, arena);
+                case Tensor<float> x:   return ToValue(x, arena);
+                case Tensor<double> x:  return ToValue(x, arena);
+                case Tensor<sbyte> x:   return ToValue(x, arena);
+                case Tensor<short> x:   return ToValue(x, arena);
+                case Tensor<int> x:     return ToValue(x, arena);
+                case Tensor<long> x:    return ToValue(x, arena);
+                case Tensor<byte> x:    return ToValue(x, arena);
+                case Tensor<ushort> x:  return ToValue(x, arena);
+                case Tensor<uint> x:    return ToValue(x, arena);
+                case Tensor<ulong> x:   return ToValue(x, arena);
+                case Tensor<bool> x:    return ToValue(x, arena);
+                case Image x:           return ToValue(x, arena: arena);
+                case string x:          return ToValue(x, arena);
                 case IList x:           return Function.CreateListValue(JsonConvert.SerializeObject(x), out var list).Throw() == Status.Ok ? list : default;
                 case IDictionary x:     return Function.CreateDictValue(JsonConvert.SerializeObject(x), out var dict).Throw() == Status.Ok ? dict : default;
-                case Stream stream:     return Function.CreateBinaryValue(stream.ToArray(), (int)stream.Length, ValueFlags.CopyData, out var binary).Throw() == Status.Ok ? binary : default;
+                case Stream x:          return ToValue(x, arena);
+                case ReadOnlyMemory<byte> x: return ToValue(x, arena);
+                case Memory<byte> x:    return ToValue((ReadOnlyMemory<byte>)x, arena);
                 case null:              return Function.CreateNullValue(out var nullptr).Throw() == Status.Ok ? nullptr : default; 
                 default:                throw new InvalidOperationException($"Cannot create a Function value from value '{value}' of type {value.GetType()}");
             }
         }
 
+        /// <summary>
+        /// Create a Function value which owns a copy of the input data, so that it can outlive the input object.
+        /// </summary>
+        /// <param name="value">Input object.</param>
+        /// <returns>Function value.</returns>
+        internal static IntPtr ToOwnedValue (object? value) => value switch {
+            Image x => ToValue(x, forceCopy: true),
+            _       => ToValue(value),
+        };
+
         internal static unsafe object? ToObject (IntPtr value) {
             // Null
             value.GetValueType(out var dtype).Throw();
@@ -536,6 +1201,7 @@ namespace Function.Services {
             value.GetValueShape(shape, dims).Throw();
             // Deserialize
             switch (dtype) {
+                case Dtype.Float16: return ToObject(ToArray<ushort>(data, shape), shape);
                 case Dtype.Float32: return ToObject<float>(data, shape);
                 case Dtype.Float64: return ToObject<double>(data, shape);
                 case Dtype.Int8:    return ToObject<sbyte>(data, shape);
@@ -556,6 +1222,38 @@ namespace Function.Services {
             }
         }
 
+        private static unsafe IntPtr CloneValue (IntPtr value) {
+            value.GetValueType(out var dtype).Throw();
+            value.GetValueData(out var data).Throw();
+            value.GetValueDimensions(out var dims).Throw();
+            var shape = new int[dims];
+            value.GetValueShape(shape, dims).Throw();
+            switch (dtype) {
+                case Dtype.Float16:
+                case Dtype.Float32:
+                case Dtype.Float64:
+                case Dtype.Int8:
+                case Dtype.Int16:
+                case Dtype.Int32:
+                case Dtype.Int64:
+                case Dtype.Uint8:
+                case Dtype.Uint16:
+                case Dtype.Uint32:
+                case Dtype.Uint64:
+                case Dtype.Bool:
+                    return Function.CreateArrayValue((void*)data, shape, dims, dtype, ValueFlags.CopyData, out var array).Throw() == Status.Ok ? array : default;
+                case Dtype.Image:
+                    return Function.CreateImageValue((byte*)data, shape[1], shape[0], shape[2], ValueFlags.CopyData, out var image).Throw() == Status.Ok ? image : default;
+                default:
+                    return ToValue(ToObject(value));
+            }
+        }
+
+        private static bool HasError (IntPtr prediction) {
+            var errorBuffer = new StringBuilder(2048);
+            return prediction.GetPredictionError(errorBuffer, errorBuffer.Capacity) == Status.Ok;
+        }
+
         private static Image ToImage (MemoryStream stream) { // DEPLOY
             var data = stream.ToArray();
             Function.CreateBinaryValue(data, data.Length, default, out var binaryValue);
@@ -581,28 +1279,134 @@ namespace Function.Services {
         ).Throw() == Status.Ok ? result : default;
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        private static unsafe IntPtr ToValue<T> (T[] array) where T : unmanaged {
-            fixed (T* data = array)
-                return ToValue(data, new [] { array.Length });
+        private static unsafe IntPtr ToValue<T> (T scalar, ValueArena? arena) where T : unmanaged {
+            // Bind scalars from the arena so that the runtime does not allocate a separate buffer to copy them into
+            if (arena == null)
+                return ToValue(&scalar);
+            var buffer = (T*)arena.Allocate(sizeof(T));
+            *buffer = scalar;
+            return ToValue(buffer, flags: ValueFlags.None);
         }
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        private static unsafe IntPtr ToValue<T> (Tensor<T> tensor) where T : unmanaged {
-            fixed (T* data = tensor)
-                return ToValue(data, tensor.shape, ValueFlags.None);
+        private static unsafe IntPtr ToValue<T> (T[] array, ValueArena? arena) where T : unmanaged {
+            fixed (T* data = array) {
+                if (arena == null)
+                    return ToValue(data, new [] { array.Length });
+                var size = array.Length * sizeof(T);
+                var buffer = arena.Allocate(size);
+                Buffer.MemoryCopy(data, buffer, size, size);
+                return ToValue((T*)buffer, new [] { array.Length }, ValueFlags.None);
+            }
         }
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        private static unsafe IntPtr ToValue (Image image, bool forcePin = false) {
-            fixed (byte* data = image)
+        private static unsafe IntPtr ToValue<T> (Tensor<T> tensor, ValueArena? arena) where T : unmanaged {
+            // Tensor data is only pinned while it is being marshaled, so it is always copied
+            fixed (T* data = tensor) {
+                if (arena == null)
+                    return ToValue(data, tensor.shape);
+                var size = (long)tensor.shape.Aggregate(1L, (a, b) => a * b) * sizeof(T);
+                var buffer = arena.Allocate(size);
+                Buffer.MemoryCopy(data, buffer, size, size);
+                return ToValue((T*)buffer, tensor.shape, ValueFlags.None);
+            }
+        }
+
+        private static unsafe IntPtr ToValue (string data, ValueArena? arena) {
+            if (arena == null)
+                return Function.CreateStringValue(data, out var value).Throw() == Status.Ok ? value : default;
+            // Encode into the arena instead of a temporary marshaling buffer
+            var size = Encoding.UTF8.GetByteCount(data);
+            var buffer = (byte*)arena.Allocate(size + 1);
+            fixed (char* chars = data)
+                Encoding.UTF8.GetBytes(chars, data.Length, buffer, size);
+            buffer[size] = 0;
+            return Function.CreateStringValue(buffer, out var result).Throw() == Status.Ok ? result : default;
+        }
+
+        private static unsafe IntPtr ToValue (ReadOnlyMemory<byte> data, ValueArena? arena) {
+            // Empty memory pins to a null pointer, so bind empty values from a valid buffer instead
+            if (data.IsEmpty) {
+                byte empty = 0;
+                return Function.CreateBinaryValue(&empty, 0, ValueFlags.CopyData, out var emptyValue).Throw() == Status.Ok ? emptyValue : default;
+            }
+            // Borrow the caller's memory for the duration of the prediction instead of copying it
+            var borrow = arena != null;
+            using var handle = borrow ? default : data.Pin();
+            var buffer = borrow ? (byte*)arena!.Pin(data) : (byte*)handle.Pointer;
+            var flags = borrow ? ValueFlags.None : ValueFlags.CopyData;
+            return Function.CreateBinaryValue(buffer, data.Length, flags, out var value).Throw() == Status.Ok ? value : default;
+        }
+
+        private static unsafe IntPtr ToValue (Stream stream, ValueArena? arena) {
+            // Binary values hold the stream data from its current position to its end
+            switch (stream) {
+                // Borrow the backing memory of in-memory and memory-mapped streams
+                case MemoryStream x when x.TryGetBuffer(out var segment):
+                    var start = (int)Math.Min(x.Position, segment.Count);
+                    return ToValue(segment.AsMemory(start), arena);
+                case MemoryMappedViewStream x when arena != null:
+                    var mappedSize = GetBinarySize(x);
+                    var view = arena.Acquire(x.SafeMemoryMappedViewHandle) + x.PointerOffset + x.Position;
+                    return Function.CreateBinaryValue(view, mappedSize, ValueFlags.None, out var mapped).Throw() == Status.Ok ? mapped : default;
+                case UnmanagedMemoryStream x when arena != null && TryGetPositionPointer(x, out var pointer):
+                    var unmanagedSize = GetBinarySize(x);
+                    return Function.CreateBinaryValue(pointer, unmanagedSize, ValueFlags.None, out var unmanaged).Throw() == Status.Ok ? unmanaged : default;
+                // Read seekable streams like files straight into the arena
+                case Stream x when arena != null && x.CanSeek:
+                    var size = GetBinarySize(x);
+                    var buffer = (byte*)arena.Allocate(size);
+                    for (int offset = 0, count; offset < size; offset += count)
+                        if ((count = x.Read(new Span<byte>(buffer + offset, size - offset))) == 0)
+                            throw new EndOfStreamException(@"Cannot create binary value because stream ended before its length");
+                    return Function.CreateBinaryValue(buffer, size, ValueFlags.None, out var read).Throw() == Status.Ok ? read : default;
+                default:
+                    using (var data = new MemoryStream()) {
+                        stream.CopyTo(data);
+                        return ToValue(new ReadOnlyMemory<byte>(data.GetBuffer(), 0, (int)data.Length), null);
+                    }
+            }
+        }
+
+        private static unsafe bool TryGetPositionPointer (UnmanagedMemoryStream stream, out byte* pointer) {
+            // Streams backed by a `SafeBuffer` do not expose a pointer, so they are read like other seekable streams
+            try {
+                pointer = stream.PositionPointer;
+                return true;
+            } catch (NotSupportedException) {
+                pointer = null;
+                return false;
+            }
+        }
+
+        private static int GetBinarySize (Stream stream) {
+            var size = stream.Length - stream.Position;
+            if (size > int.MaxValue)
+                throw new ArgumentException($"Cannot create binary value because stream has {size} bytes remaining, which is more than the maximum of {int.MaxValue} bytes", nameof(stream));
+            return (int)Math.Max(size, 0);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static unsafe IntPtr ToValue (Image image, bool forcePin = false, ValueArena? arena = null, bool forceCopy = false) {
+            fixed (byte* data = image) {
+                var pixelBuffer = data;
+                var copy = !forcePin && (image.data != null || forceCopy);
+                if (copy && arena != null) {
+                    var size = image.width * image.height * image.channels;
+                    pixelBuffer = (byte*)arena.Allocate(size);
+                    Buffer.MemoryCopy(data, pixelBuffer, size, size);
+                    copy = false;
+                }
                 return Function.CreateImageValue(
-                    data,
+                    pixelBuffer,
                     image.width,
                     image.height,
                     image.channels,
-                    !forcePin && image.data != null ? ValueFlags.CopyData : ValueFlags.None,
+                    copy ? ValueFlags.CopyData : ValueFlags.None,
                     out var value
                 ).Throw() == Status.Ok ? value : default;
+            }
         }
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
@@ -636,6 +1440,13 @@ namespace Function.Services {
             return new Tensor<T>(array, shape);
         }
 
+        private static object ToObject (ushort[] data, int[] shape) {
+            // Half-precision values are widened to single precision, since there is no `Half` type to return
+            var result = new float[data.Length];
+            FunctionUtils.ToSingle(data, result);
+            return shape.Length > 0 ? new Tensor<float>(result, shape) : result[0];
+        }
+
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         private static unsafe T[] ToArray<T> (IntPtr data, int[] shape) where T : unmanaged {
             var count = shape.Aggregate(1, (a, b) => a * b);
@@ -645,6 +1456,8 @@ namespace Function.Services {
             return result;
         }
 
+        private static string ToHex (byte[] data) => BitConverter.ToString(data).Replace(@"-", string.Empty);
+
         internal static string GetResourceName (string url) {
             var uri = new Uri(url);
             var path = uri.AbsolutePath.TrimEnd('/');            
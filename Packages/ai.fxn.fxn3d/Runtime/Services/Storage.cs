@@ -27,14 +27,10 @@ namespace Function.Services {
         /// <param name="url">Data URL.</param>
         public async Task<MemoryStream> Download (string url) {
             // Handle data URL
-            if (url.StartsWith(@"data:")) {
-                var dataIdx = url.LastIndexOf(",") + 1;
-                var b64Data = url.Substring(dataIdx);
-                var data = Convert.FromBase64String(b64Data);
-                return new MemoryStream(data, 0, data.Length, false, false);
-            }
+            if (url.StartsWith(@"data:"))
+                return DecodeDataUrl(url);
             // Remote URL
-            var dataStream = await client.Download(url);
+            using var dataStream = await client.Download(url);
             var memoryStream = new MemoryStream();
             await dataStream.CopyToAsync(memoryStream);
             // Return
@@ -102,6 +98,16 @@ namespace Function.Services {
         private readonly FunctionClient client;
 
         internal StorageService (FunctionClient client) => this.client = client;
+
+        private static MemoryStream DecodeDataUrl (string url) {
+            // Decode directly from the URL without copying out the base64 payload
+            var dataIdx = url.LastIndexOf(",") + 1;
+            var b64Data = url.AsSpan(dataIdx);
+            var data = new byte[b64Data.Length / 4 * 3];
+            if (!Convert.TryFromBase64Chars(b64Data, data, out var length))
+                throw new FormatException(@"Cannot download data URL because it does not contain valid base64 data");
+            return new MemoryStream(data, 0, length, false, true);
+        }
         #endregion
 
 
@@ -0,0 +1,351 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Types {
+
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using System.Numerics;
+    using System.Runtime.InteropServices;
+    using System.Threading.Tasks;
+    using Internal;
+
+    /// <summary>
+    /// Exact nearest-neighbor index over embeddings, like the outputs of embedding predictors.
+    /// Embeddings are stored contiguously and compared with SIMD, so that searching even large indices is fast.
+    /// The index can be searched from multiple threads, but must not be modified while it is being searched.
+    /// </summary>
+    [Preserve]
+    public sealed class EmbeddingIndex {
+
+        #region --Types--
+        /// <summary>
+        /// Embedding similarity metric.
+        /// </summary>
+        public enum Metric : int {
+            /// <summary>
+            /// Dot product. Higher scores are more similar.
+            /// </summary>
+            DotProduct = 0,
+            /// <summary>
+            /// Cosine similarity. Higher scores are more similar.
+            /// Embeddings are normalized when they are added to the index.
+            /// </summary>
+            Cosine = 1,
+            /// <summary>
+            /// Squared Euclidean distance. Lower scores are more similar.
+            /// </summary>
+            Euclidean = 2,
+        }
+
+        /// <summary>
+        /// Search result.
+        /// </summary>
+        [Preserve]
+        public readonly struct Neighbor {
+
+            /// <summary>
+            /// Embedding index, in the order that embeddings were added.
+            /// </summary>
+            public readonly int index;
+
+            /// <summary>
+            /// Similarity score.
+            /// </summary>
+            public readonly float score;
+
+            internal Neighbor (int index, float score) {
+                this.index = index;
+                this.score = score;
+            }
+        }
+        #endregion
+
+
+        #region --Client API--
+        /// <summary>
+        /// Embedding dimensions.
+        /// </summary>
+        public readonly int dimensions;
+
+        /// <summary>
+        /// Similarity metric.
+        /// </summary>
+        public readonly Metric metric;
+
+        /// <summary>
+        /// Number of embeddings in the index.
+        /// </summary>
+        public int count { get; private set; }
+
+        /// <summary>
+        /// Create an embedding index.
+        /// </summary>
+        /// <param name="dimensions">Embedding dimensions.</param>
+        /// <param name="metric">Similarity metric.</param>
+        public EmbeddingIndex (int dimensions, Metric metric = Metric.DotProduct) {
+            if (dimensions <= 0)
+                throw new ArgumentOutOfRangeException(nameof(dimensions), @"Cannot create embedding index because dimensions must be positive");
+            this.dimensions = dimensions;
+            this.metric = metric;
+            this.data = new float[dimensions * InitialCapacity];
+        }
+
+        /// <summary>
+        /// Add embeddings to the index.
+        /// </summary>
+        /// <param name="embeddings">Embedding tensor with shape (D), (1,D), or (N,D) for a batch of embeddings.</param>
+        /// <returns>Index of the first embedding that was added.</returns>
+        public unsafe int Add (Tensor<float> embeddings) {
+            var rows = GetRowCount(embeddings);
+            fixed (float* src = embeddings)
+                return Add(new ReadOnlySpan<float>(src, rows * dimensions));
+        }
+
+        /// <summary>
+        /// Add embeddings to the index.
+        /// </summary>
+        /// <param name="embeddings">Embeddings, stored contiguously. The length must be a multiple of the index dimensions.</param>
+        /// <returns>Index of the first embedding that was added.</returns>
+        public int Add (ReadOnlySpan<float> embeddings) {
+            // Check
+            if (embeddings.Length % dimensions != 0)
+                throw new ArgumentException($"Cannot add embeddings because their length {embeddings.Length} is not a multiple of the index dimensions {dimensions}", nameof(embeddings));
+            // Grow
+            var rows = embeddings.Length / dimensions;
+            var required = (count + rows) * dimensions;
+            if (required > data.Length)
+                Array.Resize(ref data, Math.Max(required, 2 * data.Length));
+            // Copy
+            var start = count;
+            var destination = data.AsSpan(start * dimensions, embeddings.Length);
+            embeddings.CopyTo(destination);
+            if (metric == Metric.Cosine)
+                for (var row = 0; row < rows; ++row)
+                    Normalize(destination.Slice(row * dimensions, dimensions));
+            count += rows;
+            return start;
+        }
+
+        /// <summary>
+        /// Find the embeddings that are most similar to a query embedding.
+        /// </summary>
+        /// <param name="query">Query embedding.</param>
+        /// <param name="count">Maximum number of results.</param>
+        /// <returns>Most similar embeddings, from most to least similar. This is empty if `count` is not positive.</returns>
+        public Neighbor[] Search (ReadOnlySpan<float> query, int count) {
+            // Check
+            if (query.Length != dimensions)
+                throw new ArgumentException($"Cannot search embedding index because query has {query.Length} dimensions instead of {dimensions}", nameof(query));
+            if (count <= 0 || this.count == 0)
+                return Array.Empty<Neighbor>();
+            // Normalize
+            var target = query.ToArray();
+            if (metric == Metric.Cosine)
+                Normalize(target);
+            // Search
+            var partitions = this.count >= ParallelThreshold ? Environment.ProcessorCount : 1;
+            var partitionSize = (this.count + partitions - 1) / partitions;
+            var results = new Neighbor[partitions][];
+            Parallel.For(0, partitions, partition => {
+                var start = partition * partitionSize;
+                var end = Math.Min(start + partitionSize, this.count);
+                results[partition] = Search(target, start, end, count);
+            });
+            // Merge
+            return partitions == 1 ? results[0] : Merge(results, count);
+        }
+
+        /// <summary>
+        /// Find the embeddings that are most similar to each query embedding in a batch.
+        /// Queries are searched in parallel.
+        /// </summary>
+        /// <param name="queries">Query embedding tensor with shape (D), (1,D), or (N,D) for a batch of queries.</param>
+        /// <param name="count">Maximum number of results per query.</param>
+        /// <returns>Most similar embeddings for each query, from most to least similar.</returns>
+        public Neighbor[][] Search (Tensor<float> queries, int count) {
+            var rows = GetRowCount(queries);
+            if (count <= 0 || this.count == 0)
+                return Enumerable.Repeat(Array.Empty<Neighbor>(), rows).ToArray();
+            var targets = new float[rows * dimensions];
+            unsafe {
+                fixed (float* src = queries)
+                    new ReadOnlySpan<float>(src, targets.Length).CopyTo(targets);
+            }
+            var results = new Neighbor[rows][];
+            Parallel.For(0, rows, row => {
+                var target = targets.AsSpan(row * dimensions, dimensions);
+                if (metric == Metric.Cosine)
+                    Normalize(target);
+                results[row] = Search(target, 0, this.count, count);
+            });
+            return results;
+        }
+
+        /// <summary>
+        /// Save the index to a file.
+        /// Embeddings are stored contiguously after a fixed-size header, so the file can be memory-mapped.
+        /// </summary>
+        /// <param name="path">File path.</param>
+        public void Save (string path) {
+            using var stream = File.Create(path);
+            using var writer = new BinaryWriter(stream);
+            writer.Write(Magic);
+            writer.Write(Version);
+            writer.Write(dimensions);
+            writer.Write((int)metric);
+            writer.Write(count);
+            writer.Flush();
+            stream.Write(MemoryMarshal.AsBytes(data.AsSpan(0, count * dimensions)));
+        }
+
+        /// <summary>
+        /// Load an index from a file.
+        /// </summary>
+        /// <param name="path">File path.</param>
+        /// <returns>Embedding index.</returns>
+        public static EmbeddingIndex Load (string path) {
+            using var stream = File.OpenRead(path);
+            using var reader = new BinaryReader(stream);
+            // Header
+            if (stream.Length < HeaderSize || reader.ReadInt32() != Magic || reader.ReadInt32() != Version)
+                throw new InvalidDataException($"Cannot load embedding index from {path} because it is not an embedding index");
+            var dimensions = reader.ReadInt32();
+            var metric = (Metric)reader.ReadInt32();
+            var count = reader.ReadInt32();
+            if (stream.Length != HeaderSize + (long)count * dimensions * sizeof(float))
+                throw new InvalidDataException($"Cannot load embedding index from {path} because it is truncated");
+            // Embeddings
+            var index = new EmbeddingIndex(dimensions, metric);
+            index.data = new float[Math.Max(count, InitialCapacity) * dimensions];
+            var bytes = MemoryMarshal.AsBytes(index.data.AsSpan(0, count * dimensions));
+            while (bytes.Length > 0) {
+                var bytesRead = stream.Read(bytes);
+                if (bytesRead == 0)
+                    throw new InvalidDataException($"Cannot load embedding index from {path} because it is truncated");
+                bytes = bytes.Slice(bytesRead);
+            }
+            index.count = count;
+            return index;
+        }
+        #endregion
+
+
+        #region --Operations--
+        private const int Magic = 0x454E5846; // FXNE
+        private const int Version = 1;
+        private const int HeaderSize = 5 * sizeof(int);
+        private const int InitialCapacity = 64;
+        private const int ParallelThreshold = 1 << 14;
+        private float[] data;
+
+        private int GetRowCount (Tensor<float> tensor) {
+            var shape = tensor.shape;
+            if (shape.Length == 0 || shape.Length > 2 || shape[shape.Length - 1] != dimensions)
+                throw new ArgumentException($"Cannot use tensor with shape ({string.Join(",", shape)}) because embeddings must have shape ({dimensions}) or (N,{dimensions})");
+            return shape.Length == 2 ? shape[0] : 1;
+        }
+
+        private Neighbor[] Search (ReadOnlySpan<float> query, int start, int end, int count) {
+            // Keep the best results in a heap whose root is the least similar result
+            var heap = new Neighbor[Math.Min(count, end - start)];
+            var size = 0;
+            var higherIsBetter = metric != Metric.Euclidean;
+            for (var row = start; row < end; ++row) {
+                var embedding = new ReadOnlySpan<float>(data, row * dimensions, dimensions);
+                var score = higherIsBetter ? Dot(query, embedding) : SquaredDistance(query, embedding);
+                if (size < heap.Length) {
+                    heap[size++] = new Neighbor(row, score);
+                    SiftUp(heap, size - 1, higherIsBetter);
+                }
+                else if (heap.Length > 0 && IsBetter(score, heap[0].score, higherIsBetter)) {
+                    heap[0] = new Neighbor(row, score);
+                    SiftDown(heap, size, higherIsBetter);
+                }
+            }
+            // Sort from most to least similar
+            Array.Sort(heap, (a, b) => higherIsBetter ? b.score.CompareTo(a.score) : a.score.CompareTo(b.score));
+            return heap;
+        }
+
+        private Neighbor[] Merge (Neighbor[][] partitions, int count) {
+            var higherIsBetter = metric != Metric.Euclidean;
+            var merged = new List<Neighbor>();
+            foreach (var partition in partitions)
+                merged.AddRange(partition);
+            merged.Sort((a, b) => higherIsBetter ? b.score.CompareTo(a.score) : a.score.CompareTo(b.score));
+            return merged.GetRange(0, Math.Min(count, merged.Count)).ToArray();
+        }
+
+        private static float Dot (ReadOnlySpan<float> a, ReadOnlySpan<float> b) {
+            var va = MemoryMarshal.Cast<float, Vector<float>>(a);
+            var vb = MemoryMarshal.Cast<float, Vector<float>>(b);
+            var accumulator = Vector<float>.Zero;
+            for (var idx = 0; idx < va.Length; ++idx)
+                accumulator += va[idx] * vb[idx];
+            var result = Vector.Dot(accumulator, Vector<float>.One);
+            for (var idx = va.Length * Vector<float>.Count; idx < a.Length; ++idx)
+                result += a[idx] * b[idx];
+            return result;
+        }
+
+        private static float SquaredDistance (ReadOnlySpan<float> a, ReadOnlySpan<float> b) {
+            var va = MemoryMarshal.Cast<float, Vector<float>>(a);
+            var vb = MemoryMarshal.Cast<float, Vector<float>>(b);
+            var accumulator = Vector<float>.Zero;
+            for (var idx = 0; idx < va.Length; ++idx) {
+                var difference = va[idx] - vb[idx];
+                accumulator += difference * difference;
+            }
+            var result = Vector.Dot(accumulator, Vector<float>.One);
+            for (var idx = va.Length * Vector<float>.Count; idx < a.Length; ++idx) {
+                var difference = a[idx] - b[idx];
+                result += difference * difference;
+            }
+            return result;
+        }
+
+        private static void Normalize (Span<float> embedding) {
+            var norm = MathF.Sqrt(Dot(embedding, embedding));
+            if (norm > 0f)
+                for (var idx = 0; idx < embedding.Length; ++idx)
+                    embedding[idx] /= norm;
+        }
+
+        private static bool IsBetter (float score, float other, bool higherIsBetter) => higherIsBetter ? score > other : score < other;
+
+        private static void SiftUp (Neighbor[] heap, int index, bool higherIsBetter) {
+            while (index > 0) {
+                var parent = (index - 1) / 2;
+                if (!IsBetter(heap[parent].score, heap[index].score, higherIsBetter))
+                    break;
+                (heap[parent], heap[index]) = (heap[index], heap[parent]);
+                index = parent;
+            }
+        }
+
+        private static void SiftDown (Neighbor[] heap, int size, bool higherIsBetter) {
+            var index = 0;
+            while (true) {
+                var worst = index;
+                var left = 2 * index + 1;
+                var right = left + 1;
+                if (left < size && IsBetter(heap[worst].score, heap[left].score, higherIsBetter))
+                    worst = left;
+                if (right < size && IsBetter(heap[worst].score, heap[right].score, higherIsBetter))
+                    worst = right;
+                if (worst == index)
+                    break;
+                (heap[worst], heap[index]) = (heap[index], heap[worst]);
+                index = worst;
+            }
+        }
+        #endregion
+    }
+}
@@ -0,0 +1,115 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Types {
+
+    using System;
+    using System.Collections.Generic;
+    using System.Linq;
+    using Internal;
+
+    /// <summary>
+    /// Prediction pipeline.
+    /// Pipelines chain edge predictors by wiring the outputs of upstream stages to the inputs of downstream stages.
+    /// Intermediate values are passed between predictors natively, without being converted to managed objects.
+    /// </summary>
+    [Preserve]
+    public sealed class Pipeline {
+
+        #region --Types--
+        /// <summary>
+        /// Pipeline stage.
+        /// </summary>
+        [Preserve]
+        public sealed class Stage {
+
+            /// <summary>
+            /// Stage name.
+            /// </summary>
+            public readonly string name;
+
+            /// <summary>
+            /// Predictor tag.
+            /// </summary>
+            public readonly string tag;
+
+            /// <summary>
+            /// Stage input bindings.
+            /// Each predictor input name maps to either a pipeline input name or an upstream stage output as `{stage}.{output}`.
+            /// </summary>
+            public readonly IReadOnlyDictionary<string, string> inputs;
+
+            internal Stage (string name, string tag, IReadOnlyDictionary<string, string> inputs) {
+                this.name = name;
+                this.tag = tag;
+                this.inputs = inputs;
+            }
+        }
+        #endregion
+
+
+        #region --Client API--
+        /// <summary>
+        /// Pipeline stages, in the order that they were added.
+        /// The pipeline results are the results of the last stage.
+        /// </summary>
+        public IReadOnlyList<Stage> stages => stageList;
+
+        /// <summary>
+        /// Create a pipeline.
+        /// </summary>
+        public Pipeline () => stageList = new List<Stage>();
+
+        /// <summary>
+        /// Add a stage to the pipeline.
+        /// Stages can only consume outputs from stages that were added before them.
+        /// </summary>
+        /// <param name="name">Stage name. Downstream stages reference this stage's outputs as `{name}.{output}`.</param>
+        /// <param name="tag">Predictor tag. This MUST be an `EDGE` predictor.</param>
+        /// <param name="inputs">Stage input bindings, mapping each predictor input name to either a pipeline input name or an upstream stage output as `{stage}.{output}`.</param>
+        /// <returns>The pipeline, for chaining.</returns>
+        public Pipeline Add (
+            string name,
+            string tag,
+            Dictionary<string, string>? inputs = null
+        ) {
+            // Check name
+            if (string.IsNullOrEmpty(name) || name.Contains('.'))
+                throw new ArgumentException($"Cannot add pipeline stage because name '{name}' is invalid", nameof(name));
+            if (stageList.Any(stage => stage.name == name))
+                throw new ArgumentException($"Cannot add pipeline stage because a stage named '{name}' already exists", nameof(name));
+            // Check bindings
+            inputs ??= new();
+            foreach (var binding in inputs.Values)
+                if (TryParseBinding(binding, out var upstream, out _) && upstream != null && !stageList.Any(stage => stage.name == upstream))
+                    throw new ArgumentException($"Cannot add pipeline stage '{name}' because it consumes output '{binding}' from unknown stage '{upstream}'", nameof(inputs));
+            // Add
+            stageList.Add(new Stage(name, tag, new Dictionary<string, string>(inputs)));
+            return this;
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly List<Stage> stageList;
+
+        /// <summary>
+        /// Parse a stage input binding.
+        /// </summary>
+        /// <param name="binding">Input binding.</param>
+        /// <param name="stage">Upstream stage name, or `null` if the binding refers to a pipeline input.</param>
+        /// <param name="name">Upstream output name or pipeline input name.</param>
+        /// <returns>Whether the binding refers to an upstream stage output.</returns>
+        internal static bool TryParseBinding (string binding, out string? stage, out string name) {
+            var separator = binding.IndexOf('.');
+            stage = separator > 0 ? binding.Substring(0, separator) : null;
+            name = separator > 0 ? binding.Substring(separator + 1) : binding;
+            return stage != null;
+        }
+        #endregion
+    }
+}
@@ -9,6 +9,7 @@
 namespace Function.Types {
 
     using System;
+    using System.Collections.Generic;
     using Newtonsoft.Json;
     using Newtonsoft.Json.Converters;
     using Internal;
@@ -16,7 +17,7 @@ namespace Function.Types {
     /// <summary>
     /// Prediction.
     /// </summary>
-    [Preserve, Serializable]
+    [Preserve, Serializable, JsonConverter(typeof(PredictionConverter))]
     public class Prediction {
 
         /// <summary>
@@ -45,6 +46,12 @@ namespace Function.Types {
         /// </summary>
         public object?[]? results;
 
+        /// <summary>
+        /// Prediction result names, in the same order as `results`.
+        /// This is only populated for `EDGE` predictions.
+        /// </summary>
+        public string[]? resultNames;
+
         /// <summary>
         /// Prediction latency in milliseconds.
         /// </summary>
@@ -72,6 +79,18 @@ namespace Function.Types {
         /// This is only populated for `EDGE` predictions.
         /// </summary>
         public string? configuration;
+
+        /// <summary>
+        /// Get a prediction result by name.
+        /// </summary>
+        /// <param name="name">Result name.</param>
+        /// <returns>Prediction result.</returns>
+        public object? GetResult (string name) {
+            var index = resultNames != null ? Array.IndexOf(resultNames, name) : -1;
+            if (index < 0 || results == null || index >= results.Length)
+                throw new KeyNotFoundException($"Cannot get prediction result '{name}' because prediction has no result with that name");
+            return results[index];
+        }
     }
 
     /// <summary>
@@ -94,5 +113,40 @@ namespace Function.Types {
         /// Resource name.
         /// </summary>
         public string? name;
+
+        /// <summary>
+        /// Resource chunks, in order.
+        /// When present, the resource is assembled from content-addressed chunks
+        /// so that only chunks which are missing from the cache are downloaded when the resource changes.
+        /// </summary>
+        public ResourceChunk[]? chunks;
+
+        /// <summary>
+        /// Hex-encoded SHA-256 checksum of the resource data.
+        /// When present, downloaded resources are verified against it.
+        /// </summary>
+        public string? checksum;
+    }
+
+    /// <summary>
+    /// Content-addressed prediction resource chunk.
+    /// </summary>
+    [Preserve, Serializable]
+    public class ResourceChunk {
+
+        /// <summary>
+        /// Hex-encoded SHA-256 hash of the chunk data.
+        /// </summary>
+        public string hash;
+
+        /// <summary>
+        /// Chunk size in bytes.
+        /// </summary>
+        public long size;
+
+        /// <summary>
+        /// Chunk URL.
+        /// </summary>
+        public string url;
     }
 }
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Types {
+
+    using System;
+    using System.Collections.Generic;
+    using Internal;
+    using Services;
+
+    /// <summary>
+    /// Prediction session.
+    /// Sessions hold persistent inputs for an edge predictor, which are marshaled once when they are bound
+    /// and reused by every prediction created with the session, so each prediction only supplies its changing inputs.
+    /// </summary>
+    /// <remarks>
+    /// Do not bind, unbind, or dispose the session while predictions with the session are in flight.
+    /// </remarks>
+    [Preserve]
+    public sealed class PredictionSession : IDisposable {
+
+        #region --Client API--
+        /// <summary>
+        /// Predictor tag.
+        /// </summary>
+        public readonly string tag;
+
+        /// <summary>
+        /// Names of persistent inputs bound to the session.
+        /// </summary>
+        public IReadOnlyCollection<string> inputs => values.Keys;
+
+        /// <summary>
+        /// Bind a persistent input to the session.
+        /// The input data is copied, so the input object can be modified or released after it is bound.
+        /// This replaces any input that is already bound with the same name.
+        /// </summary>
+        /// <param name="name">Input name.</param>
+        /// <param name="value">Input value.</param>
+        /// <returns>The session, for chaining.</returns>
+        public PredictionSession Bind (string name, object? value) {
+            if (disposed)
+                throw new ObjectDisposedException(nameof(PredictionSession));
+            // Bindings outlive the input object, so they must own their data instead of borrowing it
+            var binding = PredictionService.ToOwnedValue(value);
+            Unbind(name);
+            values.Add(name, binding);
+            return this;
+        }
+
+        /// <summary>
+        /// Unbind a persistent input from the session.
+        /// </summary>
+        /// <param name="name">Input name.</param>
+        /// <returns>Whether an input with the given name was bound.</returns>
+        public bool Unbind (string name) {
+            if (!values.TryGetValue(name, out var value))
+                return false;
+            values.Remove(name);
+            value.ReleaseValue().Throw();
+            return true;
+        }
+
+        /// <summary>
+        /// Release the persistent inputs of the session.
+        /// </summary>
+        public void Dispose () {
+            if (disposed)
+                return;
+            foreach (var value in values.Values)
+                value.ReleaseValue();
+            values.Clear();
+            disposed = true;
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly Dictionary<string, IntPtr> values;
+        private bool disposed;
+
+        /// <summary>
+        /// Persistent input values.
+        /// These are owned by the session, so they MUST be detached from input maps before the maps are released.
+        /// </summary>
+        internal IReadOnlyDictionary<string, IntPtr> bindings => !disposed ?
+            values :
+            throw new ObjectDisposedException(nameof(PredictionSession));
+
+        internal PredictionSession (string tag) {
+            this.tag = tag;
+            this.values = new Dictionary<string, IntPtr>();
+        }
+        #endregion
+    }
+}
@@ -7,6 +7,8 @@
 
 namespace Function.Types {
 
+    using System;
+    using System.Linq;
     using Internal;
 
     /// <summary>
@@ -26,15 +28,30 @@ namespace Function.Types {
         /// </summary>
         public readonly int[] shape;
 
+        /// <summary>
+        /// Offset of the first tensor element in `data`.
+        /// This is non-zero when the tensor is a slice of another tensor.
+        /// </summary>
+        public readonly int offset;
+
         /// <summary>
         /// Create a tensor.
         /// </summary>
         /// <param name="data">Tensor data.</param>
         /// <param name="shape">Tensor shape.</param>
-        public Tensor (T[] data, int[] shape) {
+        public Tensor (T[] data, int[] shape) : this(data, 0, shape) { }
+
+        /// <summary>
+        /// Create a tensor that refers to a region of a data array.
+        /// </summary>
+        /// <param name="data">Tensor data.</param>
+        /// <param name="offset">Offset of the first tensor element in `data`.</param>
+        /// <param name="shape">Tensor shape.</param>
+        public Tensor (T[] data, int offset, int[] shape) {
             this.data = data;
             this.nativeData = null;
             this.shape = shape;
+            this.offset = offset;
         }
 
         /// <summary>
@@ -47,6 +64,103 @@ namespace Function.Types {
             this.data = null!;
             this.nativeData = data;
             this.shape = shape;
+            this.offset = 0;
+        }
+
+        /// <summary>
+        /// Get a view of a single element along the first axis, like an item in a batch.
+        /// The view shares memory with this tensor, so no data is copied.
+        /// </summary>
+        /// <param name="index">Element index along the first axis.</param>
+        /// <returns>Tensor view with the first axis removed.</returns>
+        public Tensor<T> Slice (int index) {
+            var view = Slice(index, 1);
+            var viewShape = shape.Skip(1).ToArray();
+            return nativeData != null ? new Tensor<T>(view.nativeData, viewShape) : new Tensor<T>(data, view.offset, viewShape);
+        }
+
+        /// <summary>
+        /// Get a view of a range of elements along the first axis, like a window of audio frames.
+        /// The view shares memory with this tensor, so no data is copied.
+        /// </summary>
+        /// <param name="start">Start index along the first axis.</param>
+        /// <param name="length">Number of elements along the first axis.</param>
+        /// <returns>Tensor view.</returns>
+        public Tensor<T> Slice (int start, int length) {
+            // Check
+            if (shape.Length == 0)
+                throw new InvalidOperationException(@"Cannot slice tensor because it is a scalar");
+            if (start < 0 || length < 0 || start + length > shape[0])
+                throw new ArgumentOutOfRangeException(nameof(start), $"Cannot slice range [{start}, {start + length}) from tensor with shape ({string.Join(",", shape)})");
+            // Create view
+            var stride = shape.Skip(1).Aggregate(1, (a, b) => a * b);
+            var viewShape = (int[])shape.Clone();
+            viewShape[0] = length;
+            return nativeData != null ?
+                new Tensor<T>(nativeData + start * stride, viewShape) :
+                new Tensor<T>(data, offset + start * stride, viewShape);
+        }
+
+        /// <summary>
+        /// Pad the tensor with zeros up to a given shape.
+        /// Padding is applied at the end of each axis.
+        /// </summary>
+        /// <param name="shape">Padded shape. Each dimension must be greater than or equal to the tensor dimension.</param>
+        /// <returns>Padded tensor, or this tensor if it already has the given shape.</returns>
+        public Tensor<T> Pad (int[] shape) {
+            // Check rank
+            if (shape.Length != this.shape.Length)
+                throw new ArgumentException($"Cannot pad tensor with shape ({string.Join(",", this.shape)}) to shape ({string.Join(",", shape)}) because ranks differ", nameof(shape));
+            // Check dims
+            for (var axis = 0; axis < shape.Length; ++axis)
+                if (shape[axis] < this.shape[axis])
+                    throw new ArgumentException($"Cannot pad tensor with shape ({string.Join(",", this.shape)}) to smaller shape ({string.Join(",", shape)})", nameof(shape));
+            // Check identity
+            if (shape.SequenceEqual(this.shape))
+                return this;
+            // Copy rows
+            var result = new T[shape.Aggregate(1, (a, b) => a * b)];
+            var rank = shape.Length;
+            var rowLength = this.shape[rank - 1];
+            var rowCount = this.shape.Take(rank - 1).Aggregate(1, (a, b) => a * b);
+            if (rowLength * rowCount > 0)
+                fixed (T* src = this, dst = result)
+                    for (var row = 0; row < rowCount; ++row) {
+                        var dstOffset = 0;
+                        var dstStride = shape[rank - 1];
+                        for (int axis = rank - 2, index = row; axis >= 0; --axis) {
+                            dstOffset += (index % this.shape[axis]) * dstStride;
+                            dstStride *= shape[axis];
+                            index /= this.shape[axis];
+                        }
+                        Buffer.MemoryCopy(
+                            src + row * rowLength,
+                            dst + dstOffset,
+                            rowLength * sizeof(T),
+                            rowLength * sizeof(T)
+                        );
+                    }
+            // Return
+            return new Tensor<T>(result, shape);
+        }
+
+        /// <summary>
+        /// Pad the tensor with zeros along an axis up to the nearest bucket size.
+        /// Bucketing dynamic dimensions (e.g. sequence length or image size) means that edge predictors
+        /// only ever see a small set of distinct input shapes, so they reach steady state quickly.
+        /// </summary>
+        /// <param name="axis">Axis to pad. Negative values index from the last axis.</param>
+        /// <param name="buckets">Bucket sizes.</param>
+        /// <returns>Padded tensor, or this tensor if the axis is already a bucket size or is larger than every bucket.</returns>
+        public Tensor<T> Pad (int axis, params int[] buckets) {
+            axis = axis < 0 ? shape.Length + axis : axis;
+            if (axis < 0 || axis >= shape.Length)
+                throw new ArgumentOutOfRangeException(nameof(axis), $"Cannot pad tensor with shape ({string.Join(",", shape)}) along axis {axis}");
+            var size = shape[axis];
+            var bucket = buckets.Where(b => b >= size).DefaultIfEmpty(size).Min();
+            var paddedShape = (int[])shape.Clone();
+            paddedShape[axis] = bucket;
+            return Pad(paddedShape);
         }
         #endregion
 
@@ -54,7 +168,14 @@ namespace Function.Types {
         #region --Operations--
         private readonly T* nativeData;
 
-        public ref T GetPinnableReference () => ref (nativeData == null ? ref data[0] : ref *nativeData);
+        public ref T GetPinnableReference () {
+            // Empty views at the end of the data have no element to refer to, so they pin to a null pointer
+            if (nativeData != null)
+                return ref *nativeData;
+            if (offset >= data.Length)
+                return ref *(T*)null;
+            return ref data[offset];
+        }
         #endregion
     }
 }
\ No newline at end of file
@@ -8,12 +8,13 @@
 namespace Function.Types {
 
     using System;
+    using Newtonsoft.Json;
     using Internal;
 
     /// <summary>
     /// Prediction value.
     /// </summary>
-    [Preserve, Serializable]
+    [Preserve, Serializable, JsonConverter(typeof(ValueConverter))]
     public class Value {
 
         /// <summary>
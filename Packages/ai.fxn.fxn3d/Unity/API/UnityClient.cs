@@ -158,16 +158,26 @@ namespace Function.API {
         /// </summary>
         /// <param name="url">URL</param>
         public override async Task<Stream> Download (string url) {
-            using var request = UnityWebRequest.Get(url);
-            request.timeout = 20;
+            // Stream the response so that large resources are never buffered in memory
+            var downloadHandler = new DownloadHandlerStream();
+            var request = new UnityWebRequest(url, UnityWebRequest.kHttpVerbGET, downloadHandler, null) {
+                disposeDownloadHandlerOnDispose = true,
+                timeout = 20,
+            };
             request.SendWebRequest();
-            while (!request.isDone)
+            while (!request.isDone && !downloadHandler.receivedData)
                 await Task.Yield();
-            if (request.result != UnityWebRequest.Result.Success)
-                throw new InvalidOperationException(request.error);
-            var data = request.downloadHandler.data;
-            var stream = new MemoryStream(data, 0, data.Length, false, false);
-            return stream;
+            // Check error
+            if (request.responseCode >= 400)
+                while (!request.isDone)
+                    await Task.Yield();
+            if (request.isDone && request.result != UnityWebRequest.Result.Success) {
+                var error = request.error;
+                request.Dispose();
+                throw new InvalidOperationException(error);
+            }
+            // Return
+            return downloadHandler.CreateStream(request);
         }
 
         /// <summary>
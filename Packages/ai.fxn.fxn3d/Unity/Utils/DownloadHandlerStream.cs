@@ -0,0 +1,187 @@
+/*
+*   Function
+*   Copyright © 2024 NatML Inc. All rights reserved.
+*/
+
+#nullable enable
+
+namespace Function.Internal {
+
+    using System;
+    using System.Buffers;
+    using System.Collections.Concurrent;
+    using System.IO;
+    using System.Threading;
+    using System.Threading.Tasks;
+    using UnityEngine.Networking;
+
+    /// <summary>
+    /// Download handler which exposes the response as a stream while it is being received.
+    /// At most a few megabytes of the response are buffered in memory, so that large resources can be written to storage as they arrive.
+    /// On WebGL, the browser still receives the full response before it is handed to the download handler.
+    /// </summary>
+    internal sealed class DownloadHandlerStream : DownloadHandlerScript {
+
+        #region --Client API--
+        /// <summary>
+        /// Whether any response data has been received.
+        /// </summary>
+        public bool receivedData => received;
+
+        public DownloadHandlerStream () : base(new byte[BufferSize]) {
+            this.queue = new ConcurrentQueue<Chunk>();
+            this.semaphore = new SemaphoreSlim(0);
+            this.slots = new SemaphoreSlim(MaxQueuedChunks);
+        }
+
+        /// <summary>
+        /// Create a stream over the response of a request.
+        /// This must be called from the main thread.
+        /// The stream can be read from any thread, and the request is disposed once it completes.
+        /// </summary>
+        /// <param name="request">Web request which uses this download handler.</param>
+        /// <returns>Response stream.</returns>
+        public Stream CreateStream (UnityWebRequest request) {
+            _ = Track(request);
+            return new ResponseStream(this);
+        }
+        #endregion
+
+
+        #region --Operations--
+        private const int BufferSize = 1 << 16;
+        private const int MaxQueuedChunks = 64;
+        private static readonly TimeSpan BackpressureTimeout = TimeSpan.FromSeconds(1);
+        private readonly ConcurrentQueue<Chunk> queue;
+        private readonly SemaphoreSlim semaphore;
+        private readonly SemaphoreSlim slots;
+        private volatile bool received;
+        private volatile bool completed;
+        private volatile bool abandoned;
+        private string? error;
+
+        protected override bool ReceiveData (byte[] data, int dataLength) {
+            if (data == null || dataLength == 0 || abandoned)
+                return false;
+            // Wait for the reader to catch up when the queue is full.
+            // The wait is bounded because this runs on the main thread, which a reader might be waiting on.
+            // WebGL cannot wait at all because the reader runs on the main thread too.
+            #if UNITY_WEBGL && !UNITY_EDITOR
+            var slot = slots.Wait(0);
+            #else
+            var slot = slots.Wait(BackpressureTimeout);
+            #endif
+            var buffer = ArrayPool<byte>.Shared.Rent(dataLength);
+            Buffer.BlockCopy(data, 0, buffer, 0, dataLength);
+            queue.Enqueue(new Chunk(buffer, dataLength, slot));
+            received = true;
+            semaphore.Release();
+            return true;
+        }
+
+        private async Task Track (UnityWebRequest request) {
+            // Unity only allows web requests to be used from the main thread
+            var aborted = false;
+            while (!request.isDone) {
+                if (abandoned && !aborted) {
+                    request.Abort();
+                    aborted = true;
+                }
+                await Task.Yield();
+            }
+            error = request.result == UnityWebRequest.Result.Success || abandoned ? null : request.error;
+            completed = true;
+            semaphore.Release();
+            request.Dispose();
+        }
+
+        private async Task<Chunk?> ReadChunk (CancellationToken cancellationToken) {
+            while (true) {
+                var done = completed;
+                if (queue.TryDequeue(out var chunk))
+                    return chunk;
+                if (done && error != null)
+                    throw new InvalidOperationException(error);
+                if (done)
+                    return null;
+                // Readers never resume on the main thread, so that they can drain the queue while `ReceiveData` waits
+                await semaphore.WaitAsync(cancellationToken).ConfigureAwait(false);
+            }
+        }
+
+        private void ReturnChunk (Chunk chunk) {
+            ArrayPool<byte>.Shared.Return(chunk.buffer);
+            if (chunk.slot)
+                slots.Release();
+        }
+
+        private void ReturnChunks () {
+            while (queue.TryDequeue(out var chunk))
+                ReturnChunk(chunk);
+        }
+
+        private sealed class Chunk {
+
+            public readonly byte[] buffer;
+            public readonly int length;
+            public readonly bool slot;
+
+            public Chunk (byte[] buffer, int length, bool slot) {
+                this.buffer = buffer;
+                this.length = length;
+                this.slot = slot;
+            }
+        }
+
+        private sealed class ResponseStream : Stream {
+
+            private readonly DownloadHandlerStream handler;
+            private Chunk? chunk;
+            private int chunkOffset;
+            private long position;
+
+            public ResponseStream (DownloadHandlerStream handler) => this.handler = handler;
+
+            public override bool CanRead => true;
+            public override bool CanSeek => false;
+            public override bool CanWrite => false;
+            public override long Length => throw new NotSupportedException();
+            public override long Position { get => position; set => throw new NotSupportedException(); }
+
+            public override async Task<int> ReadAsync (byte[] buffer, int offset, int count, CancellationToken cancellationToken) {
+                if (chunk == null || chunkOffset == chunk.length) {
+                    if (chunk != null)
+                        handler.ReturnChunk(chunk);
+                    chunk = await handler.ReadChunk(cancellationToken).ConfigureAwait(false);
+                    chunkOffset = 0;
+                    if (chunk == null)
+                        return 0;
+                }
+                var size = Math.Min(count, chunk.length - chunkOffset);
+                Buffer.BlockCopy(chunk.buffer, chunkOffset, buffer, offset, size);
+                chunkOffset += size;
+                position += size;
+                return size;
+            }
+
+            public override int Read (byte[] buffer, int offset, int count) => throw new NotSupportedException(
+                @"Cannot read download stream synchronously because the response is received on the main thread"
+            );
+
+            public override void Flush () { }
+            public override long Seek (long offset, SeekOrigin origin) => throw new NotSupportedException();
+            public override void SetLength (long value) => throw new NotSupportedException();
+            public override void Write (byte[] buffer, int offset, int count) => throw new NotSupportedException();
+
+            protected override void Dispose (bool disposing) {
+                handler.abandoned = true;
+                if (chunk != null)
+                    handler.ReturnChunk(chunk);
+                chunk = null;
+                handler.ReturnChunks();
+                base.Dispose(disposing);
+            }
+        }
+        #endregion
+    }
+}
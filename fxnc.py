@@ -5,7 +5,7 @@
 
 from argparse import ArgumentParser
 from pathlib import Path
-from requests import get
+from requests import get, HTTPError
 from shutil import unpack_archive
 
 parser = ArgumentParser()
@@ -30,7 +30,7 @@ def _get_latest_version () -> str:
     release = response.json()
     return release["tag_name"]
 
-def main (): # CHECK # Linux
+def main ():
     args = parser.parse_args()
     version = args.version if args.version else _get_latest_version()
     LIB_PATH_BASE = Path("Packages") / "ai.fxn.fxn3d" / "Plugins"
@@ -55,6 +55,11 @@ def main (): # CHECK # Linux
             "url": f"https://cdn.fxn.ai/fxnc/{version}/Function-ios-iphoneos.framework.zip",
             "path": LIB_PATH_BASE / "iOS" / "Function.framework.zip"
         },
+        {
+            "url": f"https://cdn.fxn.ai/fxnc/{version}/libFunction-linux-x86_64.so",
+            "path": LIB_PATH_BASE / "Linux" / "x86_64" / "libFunction.so",
+            "optional": True
+        },
         {
             "url": f"https://cdn.fxn.ai/fxnc/{version}/Function-macos.dylib",
             "path": LIB_PATH_BASE / "macOS" / "Function.dylib"
@@ -65,7 +70,14 @@ def main (): # CHECK # Linux
         },
     ]
     for lib in LIBS:
-        _download_fxnc(lib["url"], lib["path"])
+        lib["path"].parent.mkdir(parents=True, exist_ok=True)
+        try:
+            _download_fxnc(lib["url"], lib["path"])
+        except HTTPError as error:
+            # Not every release publishes every platform
+            if not lib.get("optional"):
+                raise
+            print(f"Skipped {lib['path']} because it is not available for version {version}: {error}")
 
 if __name__ == "__main__":
     main()
\ No newline at end of file